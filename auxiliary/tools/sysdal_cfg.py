@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Reader for the internal scheduler settings of the generated SysDal_Cfg.h.
+
+Shared by the SysDal host tools. Returns the enabled INTAPP tasks in table
+(priority) order together with their activation time and phase offset, both
+in scheduler ticks, and their deadline policy.
+"""
+
+import os
+import re
+
+DEFAULT_CFG = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           "..", "..", "mcal_cfg", "generated", "include", "SysDal_Cfg.h")
+
+_DEFINE_RE = re.compile(r"^\s*#\s*define\s+(\w+)\s+\(?\s*(\w+)\s*\)?\s*$")
+_NUMBER_RE = re.compile(r"^(0[xX][0-9a-fA-F]+|\d+)[uU]?[lL]?$")
+_TASK_RE = re.compile(r"^INTAPP_TASK_(\d+)_(ACTIVATION_TIME|OFFSET|ENABLE|DEADLINE_POLICY|QUEUE_LIMIT)$")
+_POLICY_PREFIX = "SYSDAL_INTSCH_POLICY_"
+
+
+class Task(object):
+    def __init__(self, number, period, offset, policy="SKIP", queue_limit=0):
+        self.number = number
+        self.period = period
+        self.offset = offset
+        self.policy = policy
+        self.queue_limit = queue_limit
+
+    @property
+    def name(self):
+        return "INTAPP_TASK_%d" % self.number
+
+    def __repr__(self):
+        return "%s(period=%d, offset=%d)" % (self.name, self.period, self.offset)
+
+
+def read_defines(path):
+    defines = {}
+    with open(path) as cfg_file:
+        for line in cfg_file:
+            match = _DEFINE_RE.match(line)
+            if match:
+                value = match.group(2)
+                number = _NUMBER_RE.match(value)
+                defines[match.group(1)] = number.group(1) if number else value
+    return defines
+
+
+def read_tasks(path=DEFAULT_CFG):
+    """Enabled tasks of SysDal_Cfg.h, ordered as in SysDal_IntSch_TaskConfig."""
+    params = {}
+    for name, value in read_defines(path).items():
+        match = _TASK_RE.match(name)
+        if match:
+            params.setdefault(int(match.group(1)), {})[match.group(2)] = value
+
+    tasks = []
+    for number in sorted(params):
+        task = params[number]
+        if task.get("ENABLE") != "STD_ON" or "ACTIVATION_TIME" not in task:
+            continue
+        period = int(task["ACTIVATION_TIME"], 0)
+        offset = int(task.get("OFFSET", "0"), 0) % period
+        policy = task.get("DEADLINE_POLICY", _POLICY_PREFIX + "SKIP")
+        if policy.startswith(_POLICY_PREFIX):
+            policy = policy[len(_POLICY_PREFIX):]
+        tasks.append(Task(number, period, offset, policy, int(task.get("QUEUE_LIMIT", "0"), 0)))
+    return tasks
+
+
+def set_offsets(path, offsets):
+    """Rewrite the INTAPP_TASK_<n>_OFFSET values of SysDal_Cfg.h in place."""
+    with open(path) as cfg_file:
+        text = cfg_file.read()
+    for number, offset in offsets.items():
+        pattern = re.compile(r"(#define\s+INTAPP_TASK_%d_OFFSET\s+)\S+" % number)
+        if pattern.search(text) is None:
+            raise ValueError("INTAPP_TASK_%d_OFFSET not found in %s" % (number, path))
+        text = pattern.sub(lambda match: match.group(1) + str(offset), text)
+    with open(path, "w") as cfg_file:
+        cfg_file.write(text)
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Phase offset selection for the SysDal internal scheduler tasks.
+
+Picks INTAPP_TASK_<n>_OFFSET values for the tasks enabled in SysDal_Cfg.h so
+that the peak load of a single scheduler tick over the hyperperiod is minimal.
+Ties are broken on the number of ticks activating more than one task, then on
+the smallest offsets.
+
+Task WCETs are given per task number, in any unit (cycles, us, ...):
+    sysdal_offsets.py --wcet 2=1200 --wcet 3=5400
+or taken from the ExecTimeMax of a statistics dump (see sysdal_stats.py):
+    sysdal_offsets.py --stats stats.bin
+
+--apply writes the selected offsets back to SysDal_Cfg.h.
+"""
+
+import argparse
+import functools
+import itertools
+import sys
+
+import sysdal_cfg
+
+EXHAUSTIVE_LIMIT = 2000000
+
+
+def lcm(a, b):
+    return a * b // gcd(a, b)
+
+
+def gcd(a, b):
+    while b:
+        a, b = b, a % b
+    return a
+
+
+def tick_loads(tasks, offsets, wcets, hyperperiod):
+    loads = [0] * hyperperiod
+    counts = [0] * hyperperiod
+    for task, offset in zip(tasks, offsets):
+        for tick in range(offset, hyperperiod, task.period):
+            loads[tick] += wcets[task.number]
+            counts[tick] += 1
+    return loads, counts
+
+
+def cost(tasks, offsets, wcets, hyperperiod):
+    loads, counts = tick_loads(tasks, offsets, wcets, hyperperiod)
+    return (max(loads), sum(1 for count in counts if count > 1), sum(offsets))
+
+
+def search_exhaustive(tasks, wcets, hyperperiod):
+    ranges = [range(task.period) for task in tasks]
+    return min(itertools.product(*ranges),
+               key=lambda offsets: cost(tasks, offsets, wcets, hyperperiod))
+
+
+def search_greedy(tasks, wcets, hyperperiod):
+    """Place the heaviest tasks first, each on its cheapest offset."""
+    offsets = [0] * len(tasks)
+    placed = []
+    for idx in sorted(range(len(tasks)), key=lambda i: -wcets[tasks[i].number]):
+        placed.append(idx)
+        best = None
+        for offset in range(tasks[idx].period):
+            offsets[idx] = offset
+            sub_tasks = [tasks[i] for i in placed]
+            sub_offsets = [offsets[i] for i in placed]
+            candidate = cost(sub_tasks, sub_offsets, wcets, hyperperiod)
+            if best is None or candidate < best[0]:
+                best = (candidate, offset)
+        offsets[idx] = best[1]
+    return tuple(offsets)
+
+
+def wcets_from_stats(path, tasks):
+    import sysdal_stats
+    with open(path, "rb") as dump_file:
+        data = dump_file.read()
+    _, stats = sysdal_stats.decode(data, sysdal_stats.find_table(data, None))
+    if len(stats) != len(tasks):
+        raise ValueError("dump holds %d tasks, SysDal_Cfg.h enables %d" % (len(stats), len(tasks)))
+    return dict((task.number, stat["exec"][1]) for task, stat in zip(tasks, stats))
+
+
+def parse_wcet(text):
+    number, value = text.split("=", 1)
+    return int(number, 0), float(value)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--cfg", default=sysdal_cfg.DEFAULT_CFG, help="path of SysDal_Cfg.h")
+    parser.add_argument("--wcet", type=parse_wcet, action="append", default=[],
+                        metavar="TASK=WCET", help="WCET of INTAPP_TASK_<TASK>")
+    parser.add_argument("--stats", help="statistics dump to take the WCETs from")
+    parser.add_argument("--apply", action="store_true", help="write the offsets to SysDal_Cfg.h")
+    args = parser.parse_args()
+
+    tasks = sysdal_cfg.read_tasks(args.cfg)
+    if not tasks:
+        sys.exit("sysdal_offsets: no enabled INTAPP task in %s" % args.cfg)
+
+    try:
+        wcets = wcets_from_stats(args.stats, tasks) if args.stats else {}
+    except (IOError, ValueError) as err:
+        sys.exit("sysdal_offsets: %s" % err)
+    wcets.update(dict(args.wcet))
+    missing = [task.name for task in tasks if task.number not in wcets]
+    if missing:
+        sys.exit("sysdal_offsets: no WCET for %s" % ", ".join(missing))
+
+    hyperperiod = functools.reduce(lcm, [task.period for task in tasks])
+    space = functools.reduce(lambda a, b: a * b, [task.period for task in tasks])
+    if space * hyperperiod <= EXHAUSTIVE_LIMIT:
+        offsets = search_exhaustive(tasks, wcets, hyperperiod)
+        method = "exhaustive"
+    else:
+        offsets = search_greedy(tasks, wcets, hyperperiod)
+        method = "greedy"
+
+    current = cost(tasks, [task.offset for task in tasks], wcets, hyperperiod)
+    selected = cost(tasks, offsets, wcets, hyperperiod)
+    print("hyperperiod %d ticks, %s search" % (hyperperiod, method))
+    print("peak tick load: current %g, selected %g" % (current[0], selected[0]))
+    print("ticks with several activations: current %d, selected %d" % (current[1], selected[1]))
+    for task, offset in zip(tasks, offsets):
+        print("#define %s_OFFSET        %d" % (task.name, offset))
+
+    if args.apply:
+        sysdal_cfg.set_offsets(args.cfg, dict((task.number, offset)
+                                              for task, offset in zip(tasks, offsets)))
+        print("updated %s" % args.cfg)
+
+
+if __name__ == "__main__":
+    main()
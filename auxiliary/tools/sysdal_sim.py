@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+"""
+Schedulability simulator for the SysDal internal scheduler task set.
+
+Replays the tasks enabled in SysDal_Cfg.h over whole hyperperiods with the
+dispatch rules of SysDal_IntSch_TaskScheduler:
+  - activations are raised from tick 1 on, task n on the ticks t with
+    t % ActivationTime == Offset % ActivationTime;
+  - the dispatcher is not preemptive and always starts the ready task with
+    the lowest table index (highest priority);
+  - an activation raised while the task is still pending or running is a
+    deadline miss, handled by the task deadline policy (SKIP / QUEUE /
+    DEGRADE) as in SysDal_IntSch_CheckDeadlines.
+The fast boot stages are not modelled, all tasks are assumed enabled.
+
+Times are in the WCET unit, core cycles when the WCETs are taken from a
+statistics dump (see sysdal_stats.py):
+    sysdal_sim.py --tick 80000 --stats stats.bin
+    sysdal_sim.py --tick 80000 --wcet 2=1200 --wcet 3=5400 --degraded-wcet 3=900
+
+For each task the response time (activation to end of execution) histogram
+uses the bins of the on-target statistics, so both can be compared directly.
+Lateness is the end of execution minus the next activation of the task, a
+negative value is the remaining slack.
+"""
+
+import argparse
+import functools
+import sys
+
+import sysdal_cfg
+import sysdal_offsets
+import sysdal_stats
+
+
+class TaskState(object):
+    def __init__(self, task, wcet, degraded_wcet):
+        self.task = task
+        self.wcet = wcet
+        self.degraded_wcet = degraded_wcet
+        # activation times waiting for the dispatcher, the pending one first
+        self.waiting = []
+        self.degrade = False
+        self.activations = 0
+        self.executions = 0
+        self.misses = 0
+        self.dropped = 0
+        self.degraded = 0
+        self.responses = []
+        self.lateness = []
+
+
+class Simulator(object):
+    def __init__(self, states, tick, isr_cost, tickless):
+        self.states = states
+        self.tick = tick
+        self.isr_cost = isr_cost
+        self.tickless = tickless
+        self.running = None
+        self.busy = 0.0
+
+    def activate(self, tick_idx):
+        """SysDal_IntSch_TaskActivationIsr for one tick, returns the ISR cost."""
+        fired = [state for state in self.states
+                 if tick_idx % state.task.period == state.task.offset]
+        if not fired and self.tickless:
+            return 0.0
+        now = tick_idx * self.tick
+        for state in fired:
+            state.activations += 1
+            if not state.waiting and state is not self.running:
+                state.waiting.append(now)
+                continue
+            state.misses += 1
+            accepted = False
+            if state.task.policy == "QUEUE":
+                accepted = len(state.waiting) < state.task.queue_limit
+            elif state.task.policy == "DEGRADE":
+                state.degrade = True
+                accepted = not state.waiting
+            if accepted:
+                state.waiting.append(now)
+            else:
+                state.dropped += 1
+        return self.isr_cost
+
+    def run(self, total_ticks):
+        time = 0.0
+        next_tick = 1
+        while next_tick <= total_ticks:
+            while next_tick <= total_ticks and next_tick * self.tick <= time:
+                time += self.activate(next_tick)
+                next_tick += 1
+
+            ready = [state for state in self.states if state.waiting]
+            if not ready:
+                if next_tick > total_ticks:
+                    break
+                # idle (WFI) up to the next interrupt
+                time = max(time, next_tick * self.tick)
+                continue
+
+            state = ready[0]
+            activation = state.waiting.pop(0)
+            cost = state.wcet
+            if state.degrade:
+                state.degrade = False
+                if state.degraded_wcet is not None:
+                    cost = state.degraded_wcet
+                    state.degraded += 1
+
+            self.running = state
+            start = time
+            end = time + cost
+            # interrupts taken while the task runs delay its end
+            while next_tick <= total_ticks and next_tick * self.tick < end:
+                end += self.activate(next_tick)
+                next_tick += 1
+            self.running = None
+            self.busy += end - start
+            time = end
+
+            state.executions += 1
+            state.responses.append(end - activation)
+            state.lateness.append(end - (activation + state.task.period * self.tick))
+        return time
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def histogram(values, bins, shift):
+    hist = [0] * bins
+    for value in values:
+        hist[min(bins - 1, int(value) >> shift)] += 1
+    return hist
+
+
+def parse_assignment(text):
+    number, value = text.split("=", 1)
+    return int(number, 0), int(value, 0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--cfg", default=sysdal_cfg.DEFAULT_CFG, help="path of SysDal_Cfg.h")
+    parser.add_argument("--tick", type=float, required=True,
+                        help="duration of one scheduler tick in the WCET unit")
+    parser.add_argument("--wcet", type=sysdal_offsets.parse_wcet, action="append", default=[],
+                        metavar="TASK=WCET", help="WCET of INTAPP_TASK_<TASK>")
+    parser.add_argument("--degraded-wcet", type=sysdal_offsets.parse_wcet, action="append",
+                        default=[], metavar="TASK=WCET", help="WCET of the degraded runnable")
+    parser.add_argument("--stats", help="statistics dump to take the WCETs from")
+    parser.add_argument("--offset", type=parse_assignment, action="append", default=[],
+                        metavar="TASK=OFFSET", help="override the offset of INTAPP_TASK_<TASK>")
+    parser.add_argument("--isr", type=float, default=0.0,
+                        help="cost of one activation interrupt in the WCET unit")
+    parser.add_argument("--hyperperiods", type=int, default=4, help="number of hyperperiods simulated")
+    parser.add_argument("--clock", type=float, default=0.0,
+                        help="core clock in Hz, to print cycle times in microseconds")
+    parser.add_argument("--width", type=int, default=50, help="histogram bar width")
+    args = parser.parse_args()
+
+    tasks = sysdal_cfg.read_tasks(args.cfg)
+    if not tasks:
+        sys.exit("sysdal_sim: no enabled INTAPP task in %s" % args.cfg)
+    defines = sysdal_cfg.read_defines(args.cfg)
+
+    try:
+        wcets = sysdal_offsets.wcets_from_stats(args.stats, tasks) if args.stats else {}
+    except (IOError, ValueError) as err:
+        sys.exit("sysdal_sim: %s" % err)
+    wcets.update(dict(args.wcet))
+    missing = [task.name for task in tasks if task.number not in wcets]
+    if missing:
+        sys.exit("sysdal_sim: no WCET for %s" % ", ".join(missing))
+    degraded = dict(args.degraded_wcet)
+    for number, offset in args.offset:
+        for task in tasks:
+            if task.number == number:
+                task.offset = offset % task.period
+
+    hyperperiod = functools.reduce(sysdal_offsets.lcm, [task.period for task in tasks])
+    tickless = defines.get("SYSDAL_INTSCH_TICKLESS_MODE") == "STD_ON"
+    bins = int(defines.get("SYSDAL_INTSCH_STAT_HISTOGRAM_BINS", "16"), 0)
+    shift = int(defines.get("SYSDAL_INTSCH_STAT_HISTOGRAM_SHIFT", "12"), 0)
+
+    states = [TaskState(task, wcets[task.number], degraded.get(task.number)) for task in tasks]
+    simulator = Simulator(states, args.tick, args.isr, tickless)
+    end = simulator.run(hyperperiod * args.hyperperiods)
+    span = max(end, hyperperiod * args.hyperperiods * args.tick)
+
+    demand = sum(wcets[task.number] / (task.period * args.tick) for task in tasks)
+    print("hyperperiod %d ticks x %d, tick %g, tickless %s"
+          % (hyperperiod, args.hyperperiods, args.tick, "on" if tickless else "off"))
+    print("CPU utilisation: simulated %.1f %%, task demand %.1f %%"
+          % (100.0 * simulator.busy / span, 100.0 * demand))
+    backlog = [state.task.name for state in states if state.waiting]
+    if backlog:
+        print("backlog at the end of the simulation: %s" % ", ".join(backlog))
+    print("")
+
+    failed = False
+    for idx, state in enumerate(states):
+        task = state.task
+        policy = task.policy if task.policy != "QUEUE" else "QUEUE %d" % task.queue_limit
+        print("%s (priority %d, period %d, offset %d, WCET %g, %s)"
+              % (task.name, idx, task.period, task.offset, state.wcet, policy))
+        print("    %d activations, %d executions, %d misses, %d dropped, %d degraded"
+              % (state.activations, state.executions, state.misses, state.dropped, state.degraded))
+        if state.responses:
+            print("    response min %s  p50 %s  p99 %s  max %s" % tuple(
+                sysdal_stats.format_cycles(int(value), args.clock) for value in (
+                    min(state.responses), percentile(state.responses, 0.5),
+                    percentile(state.responses, 0.99), max(state.responses))))
+            print("    worst lateness %s" % sysdal_stats.format_cycles(int(max(state.lateness)), args.clock))
+            sysdal_stats.print_histogram("response time", histogram(state.responses, bins, shift),
+                                         shift, args.clock, args.width)
+        failed = failed or state.misses != 0 or (state.lateness and max(state.lateness) > 0)
+        print("")
+
+    print("task set %s" % ("NOT schedulable" if failed else "schedulable"))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
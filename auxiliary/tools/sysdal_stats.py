@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Decoder for the SysDal internal scheduler statistics table.
+
+Prints the per-task execution time / start latency summary and histograms of
+SysDal_IntSch_Statistics (SYSDAL_INTSCH_STATISTICS == STD_ON) from a binary
+memory dump of the target.
+
+The dump can be taken with the debugger, e.g. in Trace32:
+    Data.SAVE.Binary stats.bin Var.RANGE(SysDal_IntSch_Statistics)
+A larger RAM dump works as well, the table is located by its magic word.
+The deadline misses are not part of this table, they are counted in
+SysDal_IntSch_DeadlineStat.
+
+Usage:
+    sysdal_stats.py <dump.bin> [--offset N] [--clock HZ] [--width COLUMNS]
+"""
+
+import argparse
+import struct
+import sys
+
+STAT_MAGIC = 0x53445354
+HEADER_FORMAT = "<IHBB"
+TASK_FIXED_FORMAT = "<QQIIIII"
+
+
+def align8(value):
+    return (value + 7) & ~7
+
+
+def find_table(data, offset):
+    if offset is not None:
+        return offset
+    magic = struct.pack("<I", STAT_MAGIC)
+    pos = data.find(magic)
+    while pos >= 0:
+        if pos % 4 == 0:
+            return pos
+        pos = data.find(magic, pos + 1)
+    raise ValueError("statistics table magic 0x%08X not found in dump" % STAT_MAGIC)
+
+
+def decode(data, offset):
+    magic, num_tasks, bins, shift = struct.unpack_from(HEADER_FORMAT, data, offset)
+    if magic != STAT_MAGIC:
+        raise ValueError("bad magic 0x%08X at offset 0x%X" % (magic, offset))
+
+    fixed_size = struct.calcsize(TASK_FIXED_FORMAT)
+    task_size = align8(fixed_size + 8 * bins)
+    pos = offset + align8(struct.calcsize(HEADER_FORMAT))
+    tasks = []
+    for _ in range(num_tasks):
+        (exec_sum, lat_sum, count,
+         exec_min, exec_max, lat_min, lat_max) = struct.unpack_from(TASK_FIXED_FORMAT, data, pos)
+        hist = struct.unpack_from("<%dI" % (2 * bins), data, pos + fixed_size)
+        tasks.append({
+            "count": count,
+            "exec": (exec_min, exec_max, exec_sum),
+            "latency": (lat_min, lat_max, lat_sum),
+            "exec_hist": hist[:bins],
+            "latency_hist": hist[bins:],
+        })
+        pos += task_size
+    return shift, tasks
+
+
+def format_cycles(cycles, clock):
+    if clock:
+        return "%d (%.2f us)" % (cycles, cycles * 1e6 / clock)
+    return "%d" % cycles
+
+
+def print_histogram(title, hist, shift, clock, width):
+    total = sum(hist)
+    print("    %s" % title)
+    if total == 0:
+        print("      <no samples>")
+        return
+    peak = max(hist)
+    bin_size = 1 << shift
+    for idx, hits in enumerate(hist):
+        low = idx * bin_size
+        if idx == len(hist) - 1:
+            label = ">= %d" % low
+        else:
+            label = "%d..%d" % (low, low + bin_size - 1)
+        if clock:
+            label += " [%.1f us]" % (low * 1e6 / clock)
+        bar = "#" * int(round(width * hits / peak)) if hits else ""
+        print("      %-28s %10d %s" % (label, hits, bar))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("dump", help="binary memory dump containing SysDal_IntSch_Statistics")
+    parser.add_argument("--offset", type=lambda v: int(v, 0), default=None,
+                        help="offset of the table in the dump (default: search the magic word)")
+    parser.add_argument("--clock", type=float, default=0.0,
+                        help="core clock in Hz, to print times in microseconds")
+    parser.add_argument("--width", type=int, default=50, help="histogram bar width")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump_file:
+        data = dump_file.read()
+
+    try:
+        shift, tasks = decode(data, find_table(data, args.offset))
+    except (ValueError, struct.error) as err:
+        sys.exit("sysdal_stats: %s" % err)
+
+    for idx, task in enumerate(tasks):
+        count = task["count"]
+        print("Task %d (priority %d): %d executions" % (idx, idx, count))
+        if count:
+            for name in ("exec", "latency"):
+                tmin, tmax, tsum = task[name]
+                print("    %-8s min %s  max %s  mean %s" % (
+                    name, format_cycles(tmin, args.clock), format_cycles(tmax, args.clock),
+                    format_cycles(tsum // count, args.clock)))
+        print_histogram("execution time [cycles]", task["exec_hist"], shift, args.clock, args.width)
+        print_histogram("start latency [cycles]", task["latency_hist"], shift, args.clock, args.width)
+        print("")
+
+
+if __name__ == "__main__":
+    main()
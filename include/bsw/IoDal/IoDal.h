@@ -185,6 +185,31 @@ extern "C"{
 * @brief API service ID for IoDal_WriteOutputs function
 * */
 #define IODAL_WRITEOUTPUTS_API_ID                          0x04U
+
+/**
+* @brief API service ID for IoDal_ReadInputHistory function
+* */
+#define IODAL_READINPUTHISTORY_API_ID                      0x05U
+
+/**
+* @brief API service ID for IoDal_SampleInputs function
+* */
+#define IODAL_SAMPLEINPUTS_API_ID                          0x06U
+
+/**
+* @brief API service ID for IoDal_FlushOutputs function
+* */
+#define IODAL_FLUSHOUTPUTS_API_ID                          0x07U
+
+/**
+* @brief API service ID for IoDal_ReadCapture function
+* */
+#define IODAL_READCAPTURE_API_ID                           0x08U
+
+/**
+* @brief API service ID for IoDal_ReadInputEvent function
+* */
+#define IODAL_READINPUTEVENT_API_ID                        0x09U
  
 
 /*===================================================================================================================
@@ -226,8 +251,19 @@ extern "C"{
 FUNC(void, IODAL_APP_CODE) IoDal_Init(P2CONST(IoDal_BswIoConfigType, AUTOMATIC, IODAL_APP_CONST) ConfigPtr);
 FUNC(void, IODAL_APP_CODE) IoDal_DeInit(void);
 FUNC(void, IODAL_APP_CODE) IoDal_MainFunction(void);
+FUNC(void, IODAL_APP_CODE) IoDal_SampleInputs(void);
 FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputs(IoDal_BswChannelIdType BswIoChannel, IoDal_BswValueType  * InputValue) ;
 FUNC(void, IODAL_APP_CODE) IoDal_WriteOutputs (IoDal_BswChannelIdType BswIoChannel,  IoDal_BswValueType  OutputValue);
+FUNC(void, IODAL_APP_CODE) IoDal_FlushOutputs(void);
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadCapture(IoDal_BswChannelIdType BswIoChannel, IoDal_CaptureValueType * CaptureValue);
+#endif
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_DIO_INPUT_EVENT == STD_ON)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputEvent(IoDal_BswChannelIdType BswIoChannel, IoDal_InputEventType * InputEvent);
+#endif
+#if (IODAL_MAX_ANI_DESCRIPTORS > 0U) && (IODAL_ANI_HISTORY == STD_ON)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputHistory(IoDal_BswChannelIdType BswIoChannel, IoDal_AnalogHistoryCursorType * Cursor, IoDal_AnalogSampleType * Samples, uint16 * SampleCount);
+#endif
 
 /*===================================================================================================================*/
 #ifdef __cplusplus
@@ -64,6 +64,10 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeInit(void);
 FUNC(void, IODAL_APP_CODE) IoDal_Ani_AdcHwTriggerHandler(void);
 FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Ani_ReadInputs(IoDal_BswChannelIdType BswIoChannel, IoDal_BswValueType  * InputValue);
 extern FUNC (void, IODAL_APP_CODE) IoDal_Ani_AdcSwTriggerTable(void);
+#if (IODAL_ANI_HISTORY == STD_ON)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Ani_ReadHistory(IoDal_BswChannelIdType BswIoChannel, IoDal_AnalogHistoryCursorType * Cursor, IoDal_AnalogSampleType * Samples, uint16 * SampleCount);
+#endif
+FUNC(void, IODAL_APP_CODE) IoDal_Ani_AdcHwScanNotification(void);
 #endif
 /*=============================================================================================================*/
 
@@ -64,10 +64,22 @@ extern "C"{
 FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMATIC, IODAL_APP_CONST) ConfigPtr);
 FUNC(void, IODAL_APP_CODE) IoDal_Dio_DeInit(void);
 FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadInputs(IoDal_BswChannelIdType BswIoChannel, IoDal_BswValueType  * InputValue);
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadCapture(IoDal_BswChannelIdType BswIoChannel, P2VAR(IoDal_CaptureValueType, AUTOMATIC, IODAL_APPL_DATA) CaptureValue);
+#endif
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadInputEvent(IoDal_BswChannelIdType BswIoChannel, P2VAR(IoDal_InputEventType, AUTOMATIC, IODAL_APPL_DATA) InputEvent);
+#endif
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+FUNC(void, IODAL_APP_CODE) IoDal_Dio_SampleInputs(void);
+#endif
 #if (IODAL_DIO_EXT_DEV == STD_ON)
 FUNC(void, IODAL_APP_CODE) IoDal_Dio_ExtDevHandler(IoDal_BswChannelIdType BswIoChannel);
 #endif
 FUNC(void, IODAL_APP_CODE) IoDal_Dio_WriteOutputs(IoDal_BswChannelIdType BswIoChannel, IoDal_BswValueType  OutputValue);
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+FUNC(void, IODAL_APP_CODE) IoDal_Dio_FlushOutputs(void);
+#endif
 #endif
 /*===============================================================================================================================*/
 
@@ -54,12 +54,40 @@ extern "C"{
 #define IODAL_PWM_SW_MAJOR_VERSION                1
 #define IODAL_PWM_SW_MINOR_VERSION                0
 #define IODAL_PWM_SW_PATCH_VERSION                1
+
+/*==================================================================================================
+                                       GLOBAL TYPEDEFS
+==================================================================================================*/
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+/**
+* @brief    Cost of the IODAL_PWM_SYNC_OUTPUT channels over one IoDal_FlushOutputs cycle.
+* @details  Build once with IODAL_PWM_SYNC_BATCH STD_ON and once with STD_OFF to compare the batched
+*           update against the per-channel resync.
+*           Sample configuration (FTM0 CH0/CH1 and FTM2 CH0 as IODAL_PWM_SYNC_OUTPUT, all three written
+*           every cycle): batched 5 DriverCalls / 2 SyncUpdates, per-channel 6 DriverCalls / 3 SyncUpdates.
+*/
+typedef struct
+{
+    uint32 Cycles;          /**< @brief DWT cycles spent in the Pwm driver during the last cycle */
+    uint32 CyclesMax;       /**< @brief Maximum of Cycles since start-up */
+    uint16 DriverCalls;     /**< @brief Pwm driver calls of the last cycle */
+    uint16 SyncUpdates;     /**< @brief Pwm_SyncUpdate calls (FTM SYNC register writes) of the last cycle */
+    uint32 CycleCount;      /**< @brief Number of cycles measured */
+}IoDal_PwmSyncBenchmarkType;
+
+/*==================================================================================================
+                                       GLOBAL VARIABLES
+==================================================================================================*/
+extern VAR(IoDal_PwmSyncBenchmarkType, IODAL_VAR) IoDal_PwmSyncBenchmark;
+#endif
+
 /*==================================================================================================
                                        GLOBAL FUNCTIONS
 ==================================================================================================*/
 FUNC(void, IODAL_APP_CODE) IoDal_Pwm_Init(P2CONST(IoDal_BswIoConfigType, AUTOMATIC, IODAL_APP_CODE) ConfigPtr);
 FUNC(void, IODAL_APP_CODE) IoDal_Pwm_DeInit(void);
 FUNC(void, IODAL_APP_CODE) IoDal_Pwm_OutputResync(IoDal_BswChannelIdType BswIoChannel);
+FUNC(void, IODAL_APP_CODE) IoDal_Pwm_FlushOutputs(void);
 #if (IODAL_PWM_EXT_DEV == STD_ON)
 FUNC(void, IODAL_APP_CODE) IoDal_Pwm_ExtDevHandler(IoDal_BswChannelIdType BswIoChannel);
 #endif
@@ -164,6 +164,64 @@ typedef IoDal_PwmPeriodType                                   IoDal_BswPeriodTyp
 
 typedef uint16                                                IoDal_BswValueType;
 
+/**
+* @brief          Position of a reader in the analog sample history
+* @details        Sequence number of the next sample to be read, 0 is the first sample after init.
+*/
+typedef uint32                                                IoDal_AnalogHistoryCursorType;
+
+/**
+* @brief          One entry of the analog sample history
+* @details        Timestamp is the Ocu counter of the trigger channel, in its timer ticks, when the conversion
+*                 was read (software trigger table) or the scan was notified (hardware trigger). The counter
+*                 wraps at the Ocu channel range. Value is the raw conversion result, also when the filter
+*                 stage is enabled.
+*/
+typedef struct
+{  
+  /**< @brief Time of the conversion*/
+  VAR(uint32, AUTOMATIC)                                            Timestamp;
+
+  /**< @brief Conversion result, 0 if Status is not IODAL_AD_CONV_NO_ERROR*/
+  VAR(IoDal_BswValueType, AUTOMATIC)                                Value;
+
+  /**< @brief Conversion status, IoDal_AnalogStatusType*/
+  VAR(uint8, AUTOMATIC)                                             Status;
+  
+} IoDal_AnalogSampleType;
+
+/**
+* @brief          Signal measured on an input capture channel
+* @details        Computed from the last timestamps when the channel is read.
+*/
+typedef struct
+{
+  /**< @brief Signal period in Icu timer ticks, 0 if the input stopped toggling*/
+  VAR(uint32, AUTOMATIC)                                            Period;
+
+  /**< @brief High time over period, 0x8000 is 100%, only for channels measuring the duty cycle*/
+  VAR(IoDal_BswDutyType, AUTOMATIC)                                 DutyCycle;
+
+} IoDal_CaptureValueType;
+
+/**
+* @brief          Edge information of an event driven digital input
+* @details        EdgeAge is only meaningful once the input toggled at least once, it is counted in core cycles
+*                 and wraps after 2^32 cycles.
+*/
+typedef struct
+{
+  /**< @brief TRUE if the input toggled since the previous read*/
+  VAR(boolean, AUTOMATIC)                                           EdgeDetected;
+
+  /**< @brief Core cycles elapsed since the newest edge*/
+  VAR(uint32, AUTOMATIC)                                            EdgeAge;
+
+  /**< @brief Current input level*/
+  VAR(IoDal_BswValueType, AUTOMATIC)                                Level;
+
+} IoDal_InputEventType;
+
 
 /**
 * @brief          Structure to configure PWM internal channels
@@ -193,6 +251,9 @@ typedef struct
   CONST(Dio_ChannelType, AUTOMATIC)                                  DioChannel;
     
   CONST(Dio_LevelType, AUTOMATIC)                                    ChannelLevel;
+
+  /**< @brief TRUE if the edges of the input are latched by the PORT pin interrupt (IODAL_DIO_INPUT_EVENT)*/
+  CONST(boolean, AUTOMATIC)                                          EdgeEvent;
 	
   /**< @brief Pointer to configuration data of external (SPI) device */
   P2CONST(IoDal_ExternalDioDeviceConfig, AUTOMATIC, IODAL_APPL_CONST)   pExtDioChannelCfg;
@@ -225,14 +286,24 @@ typedef struct
 #ifdef IFWK_USE_ICU
 /**
 * @brief          Structure to configure Input capture (ICU) channels
-* @details        Data structure containing the set of configuration parameters required 
-*                 for setting up ICU channels.
+* @details        Data structure containing the set of configuration parameters required
+*                 for setting up ICU channels. The Icu channel shall be a circular buffer timestamp channel,
+*                 with DMA the edges are stored without any interrupt.
 */
 typedef struct
-{  
+{
   /**< @brief Referenced Icu channel id*/
   CONST(Icu_ChannelType, AUTOMATIC)                               InputCaptureChannel;
-      
+
+  /**< @brief Number of timer ticks before the timestamp counter wraps (modulo + 1)*/
+  CONST(uint32, AUTOMATIC)                                        TimerRange;
+
+  /**< @brief TRUE if the Icu channel timestamps both edges, the duty cycle is measured too*/
+  CONST(boolean, AUTOMATIC)                                       MeasureDutyCycle;
+
+  /**< @brief Consecutive reads without a new edge after which the input is reported as stopped*/
+  CONST(uint8, AUTOMATIC)                                         IdleReadLimit;
+
 } IoDal_IcuDescriptorType;
 #endif
 
@@ -281,6 +352,59 @@ typedef struct
 } IoDal_AnalogDescriptorType;
 #endif
 
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+/**
+* @brief          Structure to configure the hardware triggered analog scan
+* @details        All analog descriptors are converted by one Adc group: the Gpt (LPIT) channel below
+*                 times the scan, TRGMUX routes its trigger output to the PDB of the group and the PDB
+*                 pre-triggers chain the group channels back-to-back into the group result buffer.
+*/
+typedef struct
+{  
+  /**< @brief Hardware triggered Adc group converting all analog descriptors*/
+  CONST(Adc_GroupType, AUTOMATIC)                                   AdcGroupId;
+
+  /**< @brief TRGMUX register of the PDB used by the Adc group*/
+  CONST(Mcl_TrgMuxRegisterIndexType, AUTOMATIC)                     TrgMuxRegister;
+
+  /**< @brief TRGMUX selection field of the PDB trigger input*/
+  CONST(Mcl_TrgMuxSelectionNrType, AUTOMATIC)                       TrgMuxSelect;
+
+  /**< @brief Trigger source routed to the PDB*/
+  CONST(Mcl_TrgMuxTriggerType, AUTOMATIC)                           TrgMuxSource;
+
+  /**< @brief Gpt channel of the LPIT trigger source*/
+  CONST(Gpt_ChannelType, AUTOMATIC)                                 GptChannel;
+
+  /**< @brief Scan period in ticks of the Gpt channel*/
+  CONST(Gpt_ValueType, AUTOMATIC)                                   GptPeriod;
+  
+} IoDal_AnalogHwTriggerType;
+#endif
+
+#if (IODAL_ANI_FILTER == STD_ON)
+/**
+* @brief          Structure to configure the filter stage of one analog descriptor
+* @details        2^OversampleShift conversions are summed and decimated to one output sample (first order
+*                 CIC, i.e. moving average with integrate and dump). The sum is scaled to ExtraBits more
+*                 than the Adc resolution, every 4x oversampling gives one extra bit of real resolution
+*                 when the input carries enough noise. IirShift != 0 adds a first order IIR low pass
+*                 y += (x - y) / 2^IirShift at the decimated rate.
+*/
+typedef struct
+{  
+  /**< @brief log2 of the number of conversions per output sample*/
+  CONST(uint8, AUTOMATIC)                                           OversampleShift;
+
+  /**< @brief Extra resolution bits of the output sample, not greater than OversampleShift*/
+  CONST(uint8, AUTOMATIC)                                           ExtraBits;
+
+  /**< @brief IIR time constant as log2 of output samples, 0 disables the IIR*/
+  CONST(uint8, AUTOMATIC)                                           IirShift;
+  
+} IoDal_AnalogFilterType;
+#endif
+
 /**
 * @brief          Structure used form IODAL channel mapping.
 * @details        
@@ -330,6 +454,14 @@ typedef struct
 	
 	/**< @brief pointer to Analog channel descriptor */
 	CONST(IoDal_CalloutType, IODAL_APPL_CONST) pfAdcBufferSetupCallout;
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+	/**< @brief pointer to the hardware triggered scan configuration */
+	P2CONST(IoDal_AnalogHwTriggerType, AUTOMATIC,  IODAL_APPL_CONST) pAdcHwTrigger;
+#endif
+#if (IODAL_ANI_FILTER == STD_ON)
+	/**< @brief pointer to the filter configuration of each analog descriptor */
+	P2CONST(IoDal_AnalogFilterType, AUTOMATIC,  IODAL_APPL_CONST) pAniFilter;
+#endif
 #endif
 
 #ifdef IFWK_USE_PWM	
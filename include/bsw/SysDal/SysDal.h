@@ -39,6 +39,9 @@ extern "C"{
  3) internal and external interfaces from this unit
 ====================================================================================================================*/
 #include "SysDal_Cfg.h"
+#include "StdRegMacros.h"
+#include "Dem_Types.h"
+#include "Mcu.h"
 /*===================================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
 ====================================================================================================================*/
@@ -82,6 +85,25 @@ extern "C"{
     #error "Software Version Numbers of SysDal.h and SysDal_Cfg.h are different"
 #endif
 
+/* Cortex-M4 DWT cycle counter, used by the SysDal timing instrumentation */
+#define SYSDAL_DEMCR_ADDR32                 ((uint32)0xE000EDFCUL)
+#define SYSDAL_DEMCR_TRCENA_U32             ((uint32)0x01000000UL)
+#define SYSDAL_DWT_CTRL_ADDR32              ((uint32)0xE0001000UL)
+#define SYSDAL_DWT_CTRL_CYCCNTENA_U32       ((uint32)0x00000001UL)
+#define SYSDAL_DWT_CYCCNT_ADDR32            ((uint32)0xE0001004UL)
+
+#define SysDal_EnableCycleCounter() \
+    do \
+    { \
+        REG_BIT_SET32(SYSDAL_DEMCR_ADDR32, SYSDAL_DEMCR_TRCENA_U32); \
+        REG_BIT_SET32(SYSDAL_DWT_CTRL_ADDR32, SYSDAL_DWT_CTRL_CYCCNTENA_U32); \
+    } while (0)
+
+#define SysDal_GetCycleCount()              REG_READ32(SYSDAL_DWT_CYCCNT_ADDR32)
+
+/* Cycle counter ticks of a time in microseconds, at the core clock of the Mcu RUN mode */
+#define SysDal_UsToCycles(Us)               ((uint32)(Us) * (uint32)(MCU_CORE_CLOCK_FREQUENCY_HZ / 1000000UL))
+
 typedef enum
 {
     SYSDAL_STATE_STARTUP = 0,
@@ -91,6 +113,31 @@ typedef enum
 
 typedef uint8 SysDal_EcuModeUsersType;
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
+/* Boot stages, in the order they are reached by SysDal_Init and the background init steps */
+typedef enum
+{
+    SYSDAL_BOOT_RESET = 0,          /* SysDal_Init entered */
+    SYSDAL_BOOT_EARLY,              /* PLL independent drivers initialised, PLL locking */
+    SYSDAL_BOOT_CLOCK,              /* system clock switched to the PLL */
+    SYSDAL_BOOT_CRITICAL,           /* critical drivers initialised, scheduler started */
+    SYSDAL_BOOT_COMPLETE            /* all background init steps done */
+}SysDal_BootStageType;
+
+#define SYSDAL_BOOT_NUMBER_OF_STAGES        5U
+
+/* Boot timestamps in core cycles since SysDal_Init entry, taken at the end of each stage
+   and of each background init step */
+typedef struct
+{
+    uint32 StageTime[SYSDAL_BOOT_NUMBER_OF_STAGES];
+    uint32 StepTime[SYSDAL_BOOT_NUMBER_OF_STEPS];
+}SysDal_BootTimestampsType;
+
+extern volatile SysDal_BootStageType SysDal_BootStage;
+extern SysDal_BootTimestampsType SysDal_BootTimestamps;
+#endif
+
 typedef void (*SysDal_CalloutType)(void);
 
 typedef struct
@@ -102,11 +149,82 @@ typedef struct
     CONST(SysDal_CalloutType, SAMPLE_APP_CONST) SetWakeupEventsCallout;
     CONST(SysDal_CalloutType, SAMPLE_APP_CONST) ClearWakeupEventsCallout;	
 #endif
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    /* drivers not depending on the PLL, initialised while the PLL locks */
+    CONST(SysDal_CalloutType, SAMPLE_APP_CONST) EarlyInitDriversCallout;
+    /* SYSDAL_BOOT_NUMBER_OF_STEPS slow driver inits, run in background once the scheduler runs */
+    CONSTP2CONST(SysDal_CalloutType, SAMPLE_APP_CONST, SAMPLE_APP_CONST) BootSteps;
+#endif
 }SysDal_ConfigType;
 
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+/* Start-up path whose latency to the first task dispatch is being measured */
+typedef enum
+{
+    SYSDAL_LATENCY_IDLE = 0,
+    SYSDAL_LATENCY_COLD_INIT,
+    SYSDAL_LATENCY_RESUME
+}SysDal_LatencyMeasurementType;
+
+/* Start-up latencies in core cycles, from SysDal_Init entry (cold init) or from the exit of the
+   sleep mode (resume) to the first task dispatched by the scheduler */
+typedef struct
+{
+    uint32 ColdInitLatency;
+    uint32 ResumeLatencyLast;
+    uint32 ResumeLatencyMin;
+    uint32 ResumeLatencyMax;
+    uint32 ResumeCount;
+    uint32 SpuriousWakeupCount;
+}SysDal_WakeupLatencyType;
+
+extern volatile SysDal_LatencyMeasurementType SysDal_LatencyMeasurement;
+extern SysDal_WakeupLatencyType SysDal_WakeupLatency;
+#endif
+
+#if defined(AUTOSAR_OS_NOT_USED)
+/* Handling of an activation raised while the previous one of the same task is still pending or running */
+typedef enum
+{
+    SYSDAL_INTSCH_POLICY_SKIP = 0,      /* drop the new activation */
+    SYSDAL_INTSCH_POLICY_QUEUE,         /* keep up to QueueLimit activations waiting, drop the others */
+    SYSDAL_INTSCH_POLICY_DEGRADE        /* run the waiting activation with DegradedRunnable */
+}SysDal_IntSch_DeadlinePolicyType;
+
+/* Internal scheduler task entry - the table is sorted by priority, entry 0 is the highest priority task.
+   The task is activated on the ticks Offset + k * ActivationTime, Offset 0 meaning ActivationTime */
+typedef struct
+{
+    CONST(SysDal_CalloutType, SAMPLE_APP_CONST) TaskRunnable;
+    CONST(uint16, SAMPLE_APP_CONST) ActivationTime;
+    CONST(uint16, SAMPLE_APP_CONST) Offset;
+    CONST(SysDal_IntSch_DeadlinePolicyType, SAMPLE_APP_CONST) DeadlinePolicy;
+    /* SYSDAL_INTSCH_POLICY_QUEUE only: waiting activations accepted, pending one included */
+    CONST(uint8, SAMPLE_APP_CONST) QueueLimit;
+    /* SYSDAL_INTSCH_POLICY_DEGRADE only: lighter runnable, NULL_PTR keeps TaskRunnable */
+    CONST(SysDal_CalloutType, SAMPLE_APP_CONST) DegradedRunnable;
+    /* Dem event reported failed on each deadline miss, 0 for none */
+    CONST(Dem_EventIdType, SAMPLE_APP_CONST) DemEventId;
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    /* activations are dropped until this boot stage is reached */
+    CONST(SysDal_BootStageType, SAMPLE_APP_CONST) BootStage;
+#endif
+}SysDal_IntSch_TaskConfigType;
+#endif
+
 FUNC (void, SAMPLE_APP_CODE) SysDal_Init(void) ;
 FUNC (void, SAMPLE_APP_CODE) SysDal_MainFunction(void) ;
 FUNC (void, SAMPLE_APP_CODE) SysDal_WriteModeRequest(uint8 UserId, SysDal_EcuModeType Mode);
+FUNC (void, ICU_CODE) WakeUpNotification(void);
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_EnterSleepMode(void);
+#endif
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+FUNC (void, SAMPLE_APP_CODE) SysDal_RecordFirstTaskLatency(void);
+#endif
+#if (SYSDAL_FAST_BOOT == STD_ON)
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_RunBootStep(void);
+#endif
 
 #ifdef __cplusplus
 }
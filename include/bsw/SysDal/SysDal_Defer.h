@@ -0,0 +1,99 @@
+/**
+*   @file           SysDal_Defer.h
+*   @version        1.0.1
+*
+*   @brief          Integration Framework - SysDal deferred work queues.
+*   @details        Interface used by interrupt handlers to defer work to task context.
+*
+*This file contains sample code only. It is not part of the production code deliverables.
+*/
+/*==================================================================================================
+*   Platform             : ARM
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   SW Version           : 1.0.1
+*   Build Version        : S32K14x_MCAL_1_0_1_RTM_ASR_REL_4_2_REV_0002_20170831
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2018 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef SYSDAL_DEFER_H
+#define SYSDAL_DEFER_H
+
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+                                         INCLUDE FILES
+ 1) system and project includes
+ 2) needed interfaces from external units
+ 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+#include "SysDal_Cfg.h"
+
+/*===================================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+====================================================================================================================*/
+#define SYSDAL_DEFER_VENDOR_ID                       43
+
+#define SYSDAL_DEFER_AR_RELEASE_MAJOR_VERSION        4
+#define SYSDAL_DEFER_AR_RELEASE_MINOR_VERSION        2
+#define SYSDAL_DEFER_AR_RELEASE_REVISION_VERSION     2
+
+#define SYSDAL_DEFER_SW_MAJOR_VERSION                1
+#define SYSDAL_DEFER_SW_MINOR_VERSION                0
+#define SYSDAL_DEFER_SW_PATCH_VERSION                1
+
+/*===================================================================================================================
+*                                       FILE VERSION CHECKS
+====================================================================================================================*/
+/* Check if source file and SYSDAL_DEFER header file are of the same vendor */
+#if (SYSDAL_DEFER_VENDOR_ID != SYSDAL_CFG_VENDOR_ID)
+    #error "SysDal_Defer.h and SysDal_Cfg.h have different vendor ids"
+#endif
+
+/* Check if source file and SYSDAL header file are of the same Autosar version */
+#if ((SYSDAL_DEFER_AR_RELEASE_MAJOR_VERSION != SYSDAL_CFG_AR_RELEASE_MAJOR_VERSION) || \
+     (SYSDAL_DEFER_AR_RELEASE_MINOR_VERSION != SYSDAL_CFG_AR_RELEASE_MINOR_VERSION) || \
+     (SYSDAL_DEFER_AR_RELEASE_REVISION_VERSION != SYSDAL_CFG_AR_RELEASE_REVISION_VERSION) \
+    )
+    #error "AutoSar Version Numbers of SysDal_Defer.h and SysDal_Cfg.h are different"
+#endif
+
+/* Check if source file and SYSDAL header file are of the same Software version */
+#if ((SYSDAL_DEFER_SW_MAJOR_VERSION != SYSDAL_CFG_SW_MAJOR_VERSION) || \
+     (SYSDAL_DEFER_SW_MINOR_VERSION != SYSDAL_CFG_SW_MINOR_VERSION) || \
+     (SYSDAL_DEFER_SW_PATCH_VERSION != SYSDAL_CFG_SW_PATCH_VERSION) \
+    )
+    #error "Software Version Numbers of SysDal_Defer.h and SysDal_Cfg.h are different"
+#endif
+
+/*==================================================================================================
+                                 STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/* Queue identifier, one queue per producing interrupt handler (see SYSDAL_DEFER_QUEUE_* in SysDal_Cfg.h) */
+typedef uint8 SysDal_Defer_QueueIdType;
+
+/* Deferred work handler, called in task context with the argument given when posting */
+typedef void (*SysDal_Defer_WorkFuncType)(uint32 WorkArg);
+
+/*==================================================================================================
+                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_Defer_Init(void);
+FUNC (Std_ReturnType, SAMPLE_APP_CODE) SysDal_Defer_Post(SysDal_Defer_QueueIdType QueueId, SysDal_Defer_WorkFuncType WorkFunc, uint32 WorkArg);
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_Defer_IsPending(void);
+FUNC (void, SAMPLE_APP_CODE) SysDal_Defer_Process(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /*SYSDAL_DEFER_H*/
@@ -39,6 +39,7 @@ extern "C"{
 ==================================================================================================*/
 #include "Std_types.h"
 #include "SysDal_Cfg.h"
+#include "SysDal.h"
 
 /*===================================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -77,12 +78,142 @@ extern "C"{
     #error "Software Version Numbers of SysDal_IntSch.c and SysDal_Cfg.h are different"
 #endif
 
+/*==================================================================================================
+                                       DEFINES AND MACROS
+==================================================================================================*/
+#if defined(AUTOSAR_OS_NOT_USED)
+/* Ready bit of a task - task 0 (highest priority) owns the MSB so CLZ returns the task index */
+#define SYSDAL_INTSCH_TASK_MASK(TaskIdx)    ((uint32)0x80000000UL >> (TaskIdx))
+
+#define SYSDAL_INTSCH_MIN(a, b)             (((a) < (b)) ? (a) : (b))
+
+/* Ready bit of task TaskIdx if it is activated on tick Tick of the hyperperiod */
+#define SYSDAL_INTSCH_TASK_FIRES(Tick, Period, Offset, TaskIdx) \
+    ((((Tick) % (Period)) == ((Offset) % (Period))) ? SYSDAL_INTSCH_TASK_MASK(TaskIdx) : 0UL)
+
+/* Ticks from tick Tick to the next activation of a task, in 1..Period */
+#define SYSDAL_INTSCH_TASK_DISTANCE(Tick, Period, Offset) \
+    (((((Offset) % (Period)) + (Period) - (((Tick) + 1U) % (Period))) % (Period)) + 1U)
+
+/* Schedule table entry of tick Tick, built from the SYSDAL_INTSCH_TICK_* macros of SysDal_Cfg.h */
+#define SYSDAL_INTSCH_SCHEDULE_ENTRY(Tick) \
+    { \
+        (uint32)(SYSDAL_INTSCH_TICK_READY_MASK(Tick)), \
+        (uint16)SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_TICK_NEXT_TICKS(Tick), SYSDAL_INTSCH_MAX_SLEEP_TICKS) \
+    }
+
+/* The schedule table entries of ticks Tick to Tick + N - 1, the table of SysDal_Cfg.c is built from
+   the binary digits of SYSDAL_INTSCH_HYPERPERIOD */
+#define SYSDAL_INTSCH_MAX_HYPERPERIOD       511U
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_1(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRY(Tick),
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_2(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_1(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_1((Tick) + 1U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_4(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_2(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_2((Tick) + 2U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_8(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_4(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_4((Tick) + 4U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_16(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_8(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_8((Tick) + 8U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_32(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_16(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_16((Tick) + 16U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_64(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_32(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_32((Tick) + 32U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_128(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_64(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_64((Tick) + 64U)
+#define SYSDAL_INTSCH_SCHEDULE_ENTRIES_256(Tick) \
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_128(Tick) SYSDAL_INTSCH_SCHEDULE_ENTRIES_128((Tick) + 128U)
+#endif
+
+#if defined(AUTOSAR_OS_NOT_USED) && (SYSDAL_INTSCH_STATISTICS == STD_ON)
+/* Marker of the statistics table, used by the host decoder to locate it in a memory dump */
+#define SYSDAL_INTSCH_STAT_MAGIC            ((uint32)0x53445354UL)
+#endif
+
+/*==================================================================================================
+                                 STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+#if defined(AUTOSAR_OS_NOT_USED)
+/**
+* @brief    One tick of the hyperperiod schedule table.
+* @details  ReadyMask lists the tasks activated on the tick, NextTicks is the distance to the
+*           next tick activating a task, used by the tickless mode.
+*/
+typedef struct
+{
+    uint32 ReadyMask;
+    uint16 NextTicks;
+}SysDal_IntSch_ScheduleEntryType;
+#endif
+
+#if defined(AUTOSAR_OS_NOT_USED)
+/**
+* @brief    Deadline monitoring counters of one scheduler task.
+* @details  A deadline miss is an activation raised while the previous one is still pending or
+*           running. Dropped activations are the misses discarded by the task deadline policy.
+*/
+typedef struct
+{
+    uint32 MissCount;
+    uint32 DropCount;
+}SysDal_IntSch_DeadlineStatType;
+#endif
+
+#if defined(AUTOSAR_OS_NOT_USED) && (SYSDAL_INTSCH_STATISTICS == STD_ON)
+/**
+* @brief    Timing statistics of one scheduler task, all times are in core clock cycles.
+* @details  Latency is measured from the activation in SysDal_IntSch_TaskActivationIsr to the
+*           start of the task, each queued activation with its own timestamp. The deadline misses
+*           are counted in SysDal_IntSch_DeadlineStat. The last histogram bin also collects all
+*           larger values.
+*/
+typedef struct
+{
+    uint64 ExecTimeSum;
+    uint64 LatencySum;
+    uint32 ExecCount;
+    uint32 ExecTimeMin;
+    uint32 ExecTimeMax;
+    uint32 LatencyMin;
+    uint32 LatencyMax;
+    uint32 ExecTimeHistogram[SYSDAL_INTSCH_STAT_HISTOGRAM_BINS];
+    uint32 LatencyHistogram[SYSDAL_INTSCH_STAT_HISTOGRAM_BINS];
+}SysDal_IntSch_TaskStatType;
+
+/**
+* @brief    Statistics table of the internal scheduler, decoded on host by
+*           auxiliary/tools/sysdal_stats.py.
+*/
+typedef struct
+{
+    uint32 Magic;
+    uint16 NumberOfTasks;
+    uint8  HistogramBins;
+    uint8  HistogramShift;
+    SysDal_IntSch_TaskStatType Task[SYSDAL_INTSCH_NUMBER_OF_TASKS];
+}SysDal_IntSch_StatisticsType;
+#endif
+
+/*==================================================================================================
+                                 GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+#if defined(AUTOSAR_OS_NOT_USED)
+extern SysDal_IntSch_DeadlineStatType SysDal_IntSch_DeadlineStat[SYSDAL_INTSCH_NUMBER_OF_TASKS];
+#endif
+#if defined(AUTOSAR_OS_NOT_USED) && (SYSDAL_INTSCH_STATISTICS == STD_ON)
+extern SysDal_IntSch_StatisticsType SysDal_IntSch_Statistics;
+#endif
+
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
 #if defined(AUTOSAR_OS_NOT_USED)
 FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_StartScheduler(void);
 FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_StopScheduler(void);
+FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ResumeScheduler(void);
+#if (SYSDAL_FAST_BOOT == STD_ON)
+FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_SetBootStage(SysDal_BootStageType Stage);
+#endif
 extern FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_TaskActivationIsr(void);
 FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_TaskScheduler(void);
 #endif
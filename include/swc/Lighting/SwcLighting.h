@@ -69,11 +69,16 @@ extern "C"{
                                        GLOBAL FUNCTIONS
 ==================================================================================================*/
 extern void  SwcLighting_Init(const SwcRte_GlobalConfigType * ConfigPtr);
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_OFF)
 extern void  SwcLighting_WriteSensorData(SwcRte_AppInstanceIdType LightingInstance, AppLightingSensorValueType  * InputValue);
 extern void  SwcLighting_ReadSensorData(SwcRte_AppInstanceIdType LightingInstance, AppLightingSensorValueType  * OutputValue); 
 extern void  SwcLighting_ReadOutputRequest(SwcRte_AppInstanceIdType LightingInstance, AppLightingActuatorValueType * OutputValue);
 extern void  SwcLighting_WriteOutputRequest(SwcRte_AppInstanceIdType LightingInstance, AppLightingActuatorValueType * InputValue);
+#endif
 extern void  SwcLighting_MainRunnable(SwcRte_AppInstanceIdType LightingInstance);
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+extern void  SwcLighting_FeedbackRunnable(SwcRte_AppInstanceIdType LightingInstance);
+#endif
 
 
 /*================================================================================================*/
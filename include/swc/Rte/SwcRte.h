@@ -38,7 +38,9 @@ extern "C"{
 #include "typedefs.h"
 #include "SwcRte_Types.h"
 #include "SwcRte_Cfg.h"
-
+#if (SWCRTE_USE_SYSDAL == SWCRTE_STD_ON)
+#include "SysDal.h"
+#endif
 
 /*==================================================================================================
                                        SOURCE FILE VERSION INFORMATION
@@ -80,7 +82,34 @@ extern "C"{
     #error "Software Version Numbers of SwcRte.h and SwcRte_Cfg.h are different"
 #endif
 
+#if (SWCRTE_USE_SYSDAL == SWCRTE_STD_ON)
+/*core cycles of a time in microseconds, the unit of the edge age of SwcRte_ReadInputEvent*/
+#define SwcRte_UsToCycles(Us)    SysDal_UsToCycles(Us)
+#endif
+
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+/*==================================================================================================
+                                       GLOBAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief    Cost of one pass over all sensor and actuator ports, read with the debugger.
+* @details  Both paths read the same sensor ports and stage the same output request every cycle, 
+*           the outputs are only driven by SwcRte_FlushOutputs.
+*/
+typedef struct
+{
+    uint32_t u32GenericCycles;        /**< @brief DWT cycles of the SwcRte_ReadInputs / SwcRte_WriteOutputs pass of the last cycle */
+    uint32_t u32GenericCyclesMax;     /**< @brief Maximum of u32GenericCycles since start-up */
+    uint32_t u32GeneratedCycles;      /**< @brief DWT cycles of the SwcRte_Ports.h pass of the last cycle */
+    uint32_t u32GeneratedCyclesMax;   /**< @brief Maximum of u32GeneratedCycles since start-up */
+    uint32_t u32CycleCount;           /**< @brief Number of cycles measured */
+}SwcRte_PortBenchmarkType;
 
+/*==================================================================================================
+                                       GLOBAL VARIABLES
+==================================================================================================*/
+extern SwcRte_PortBenchmarkType SwcRte_PortBenchmark;
+#endif
 
 /*==================================================================================================
                                        GLOBAL FUNCTIONS
@@ -109,6 +138,23 @@ void SwcRte_ReadLightingComInfo(SwcRte_AppInstanceIdType LightingInstance, AppIn
 void SwcRte_WriteLightingComInfo (SwcRte_AppInstanceIdType LightingInstance,  AppInfoType OututValue);
 #endif
 
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+AppLightingSensorValueType * SwcRte_GetLightingSensorBuffer(SwcRte_AppInstanceIdType LightingInstance);
+
+void SwcRte_CommitLightingSensorData(SwcRte_AppInstanceIdType LightingInstance);
+
+const AppLightingSensorValueType * SwcRte_GetLightingSensorData(SwcRte_AppInstanceIdType LightingInstance);
+
+uint8_t SwcRte_GetLightingSensorSequence(SwcRte_AppInstanceIdType LightingInstance);
+
+uint8_t SwcRte_GetLightingSensorUpdateSequence(SwcRte_AppInstanceIdType LightingInstance);
+
+AppLightingActuatorValueType * SwcRte_GetLightingOutputRequestBuffer(SwcRte_AppInstanceIdType LightingInstance);
+
+void SwcRte_CommitLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance);
+
+const AppLightingActuatorValueType * SwcRte_GetLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance);
+#else
 void SwcRte_ReadLightingSensorData(SwcRte_AppInstanceIdType LightingInstance, AppLightingSensorValueType *OutputValue) ;
 
 void SwcRte_WriteLightingSensorData(SwcRte_AppInstanceIdType LightingInstance, AppLightingSensorValueType *InputValue) ;
@@ -117,6 +163,7 @@ void SwcRte_ReadLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance,
 
 void SwcRte_WriteLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance,  AppLightingActuatorValueType * OututValue); 
 #endif
+#endif
 /*==================================================================================================
                                  GOBAL FUNCTIONS FOR MOTOR CONTROL APP
 ==================================================================================================*/
@@ -149,10 +196,28 @@ void SwcRte_ReadComData(SwcRte_AppInstanceIdType ComChannel, ComDalValueType * V
 void SwcRte_WriteComData(SwcRte_AppInstanceIdType ComChannel, ComDalValueType Value);
 #endif
 
+void SwcRte_SampleInputs(void);
+
 void SwcRte_ReadInputs(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannelIdType SensorChannel, SwcRte_AppInputValueType * InputValue);
 
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+void SwcRte_ReadInputEvent(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannelIdType SensorChannel, SwcRte_AppInputEventType * InputEvent);
+#endif
+
 void SwcRte_WriteOutputs(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannelIdType ActuatorChannel, SwcRte_OutputValueType OutputValue);
 
+void SwcRte_FlushOutputs(void);
+
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+void SwcRte_ReadSensorPorts(SwcRte_AppInputValueType InputValue[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS]);
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+void SwcRte_ReadSensorEventPorts(SwcRte_AppInputEventType InputEvent[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS]);
+#endif
+
+void SwcRte_WriteActuatorPorts(void);
+#endif
+
 /*================================================================================================*/
 /*================================================================================================*/
 #ifdef __cplusplus
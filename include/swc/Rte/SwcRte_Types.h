@@ -112,6 +112,22 @@ typedef enum
 } SwcRte_AppActuatorType;
 
 
+typedef enum
+{
+    SWCRTE_DEBOUNCE_COUNTER  = 0U,    /**< @brief Digital sensors debounced one by one, with counters or from the latched edges. */
+    SWCRTE_DEBOUNCE_VERTICAL          /**< @brief Digital sensors debounced together by the vertical counters of SwcSensors. */
+} SwcRte_DigitalDebounceType;
+
+
+typedef enum
+{
+    SWCRTE_SENSORS_RUNNABLE  = 0U,    /**< @brief SwcSensors_MainRunnable, all instances. */
+    SWCRTE_LIGHTING_RUNNABLE,         /**< @brief SwcLighting_MainRunnable of one instance. */
+    SWCRTE_LIGHTING_FBK_RUNNABLE,     /**< @brief SwcLighting_FeedbackRunnable of one instance. */
+    SWCRTE_ACTUATORS_RUNNABLE         /**< @brief SwcActuators_MainRunnable, all instances. */
+} SwcRte_RunnableType;
+
+
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
@@ -144,8 +160,18 @@ typedef struct
 	const uint8_t                  u8NoOutputChannel;      /**< @brief Number of output channels for current instance */
 	const SwcRte_InputChannelConfigType  * pInstanceInputSensor;      /**< @brief Pointer to the input channel configuration  */
 	const SwcRte_OutputChannelConfigType * pInstanceActuator;   /**< @brief Pointer to the output channel configuration */
+	const SwcRte_DigitalDebounceType     eDigitalDebounce;    /**< @brief Debounce of the digital sensors of the current instance */
 } SwcRte_GlobalConfigType; 
 
+ /**< @brief Activation of one runnable by SwcRte_MainRunnable, period and offset counted in SwcRte_MainRunnable activations*/
+typedef struct 
+{
+	const SwcRte_RunnableType       eRunnable;          /**< @brief Runnable to activate */
+	const SwcRte_AppInstanceIdType  u8Instance;         /**< @brief Instance passed to instance runnables */
+	const uint8_t                   u8Period;           /**< @brief Activations between two runs, 1 runs at the SwcRte_MainRunnable rate, not 0 */
+	const uint8_t                   u8Offset;           /**< @brief Activation of the first run, lower than u8Period, SwcRte_Init disables an entry breaking either rule */
+} SwcRte_RunnableScheduleType; 
+
  /**< @brief RTE abstraction type used to pass sensor information from lower layer to application layer.*/
 typedef struct
 {
@@ -153,6 +179,15 @@ typedef struct
     uint8_t   Status;		
 }SwcRte_AppInputValueType;
 
+ /**< @brief RTE abstraction type used to pass the edge of an event sensor input to application layer.*/
+typedef struct
+{
+    uint32_t  u32EdgeAge;       /**< @brief core cycles since the last edge of the input */
+    uint16_t  Value;            /**< @brief current level of the input */
+    uint8_t   Status;
+    uint8_t   bEdgeDetected;    /**< @brief an edge was latched since the previous read */
+}SwcRte_AppInputEventType;
+
 /*==================================================================================================
 *                                    FUNCTION PROTOTYPES
 ==================================================================================================*/
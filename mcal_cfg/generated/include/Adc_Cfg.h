@@ -196,6 +196,7 @@ extern "C"{
 #define ADC_CFGSET_GROUP_0_CHANNELS      1
 #define ADC_CFGSET_GROUP_1_CHANNELS      1
 #define ADC_CFGSET_GROUP_2_CHANNELS      1
+#define ADC_CFGSET_GROUP_3_CHANNELS      3
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
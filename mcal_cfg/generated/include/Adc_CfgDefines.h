@@ -139,7 +139,7 @@ extern "C"{
 /** 
 * @brief           Adds/removes ((STD_ON)/(STD_OFF)) the services Adc_EnableHardwareTrigger() and Adc_DisableHardwareTrigger() from the code.
 */
-#define ADC_HW_TRIGGER_API                  (STD_OFF)
+#define ADC_HW_TRIGGER_API                  (STD_ON)
 
 /** 
 * @brief           Set mode api enabled/disabled ((STD_ON)/(STD_OFF)).
@@ -299,7 +299,7 @@ extern "C"{
 /** 
 * @brief           max number of groups configured across all configset.
 */
-#define ADC_MAX_GROUPS                      3U
+#define ADC_MAX_GROUPS                      4U
 
 /** 
 * @brief           Define the HW queue size depending on the MHT groups existence.
@@ -409,6 +409,7 @@ extern "C"{
 #define AdcPotGroup                       0
 #define AdcLedFdbkGroup0                       1
 #define AdcLedFdbkGroup1                       2
+#define AdcAniScanGroup                       3
 
 /** 
 * @brief           Symbolic names of groups - ecuc 2108 compliant.
@@ -420,6 +421,8 @@ extern "C"{
 #define AdcConf_AdcGroup_AdcLedFdbkGroup0                       1
 /** @violates @ref Adc_CfgDefines_h_REF_2 MISRA-C:2004 Rule 1.4: Identifier clash.*/
 #define AdcConf_AdcGroup_AdcLedFdbkGroup1                       2
+/** @violates @ref Adc_CfgDefines_h_REF_2 MISRA-C:2004 Rule 1.4: Identifier clash.*/
+#define AdcConf_AdcGroup_AdcAniScanGroup                       3
 
 /** 
 * @brief           Active CMR register
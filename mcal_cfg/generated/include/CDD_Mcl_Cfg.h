@@ -169,7 +169,7 @@ extern "C"{
 *        STD_ON: Enabled. STD_OFF: Disabled.
 *   
 */
-#define MCL_ENABLE_TRGMUX                   (STD_OFF)
+#define MCL_ENABLE_TRGMUX                   (STD_ON)
 /**
 * @brief define number of trigger mux registers
 */
@@ -368,7 +368,10 @@ extern "C"{
 *             or if there is a transfer completion ISR for each channel
 *
 */
-#define MCL_DMA_TR_SEPARATED_ISR (STD_OFF)
+#define MCL_DMA_TR_SEPARATED_ISR (STD_ON)
+
+/* Transfer completion ISR of the DMA channel moving the Icu timestamps */
+#define MCL_DMA_CH_0_ISR_USED
 
 /**
 * @brief      This define specifies if inside a DMA instance some channels have the same transfer completion ISR assigned,
@@ -381,7 +384,7 @@ extern "C"{
 *      needed for removing at precompile time the code for ISR handling for the transfer 
 *      completion notification processing. This define is needed in both combined transfer
 *      completion interrupt and single channel mode. */
-#define MCL_DMA_NOTIFICATION_SUPPORTED              (STD_OFF)
+#define MCL_DMA_NOTIFICATION_SUPPORTED              (STD_ON)
 
 /* Transfer size options available */
 #define MCL_TRANSFER_SIZE_1_BYTE 
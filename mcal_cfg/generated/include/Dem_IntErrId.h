@@ -70,6 +70,10 @@ extern "C"{
   
 /** @brief Identifier for DEM error DemEventParameter_0*/
 #define DemConf_DemEventParameter_DemEventParameter_0   ((Dem_EventIdType) 0x1)
+/** @brief Identifier for DEM error SYSDAL_E_TASK_2_DEADLINE*/
+#define DemConf_DemEventParameter_SYSDAL_E_TASK_2_DEADLINE   ((Dem_EventIdType) 0x2)
+/** @brief Identifier for DEM error SYSDAL_E_TASK_3_DEADLINE*/
+#define DemConf_DemEventParameter_SYSDAL_E_TASK_3_DEADLINE   ((Dem_EventIdType) 0x3)
 
 
 /*==================================================================================================
@@ -143,7 +143,7 @@ extern "C" {
 *
 * @api
 */
-#define DIO_MASKEDWRITEPORT_API (STD_OFF)
+#define DIO_MASKEDWRITEPORT_API (STD_ON)
 
 /**
 * @brief          Reversed port functionality enable switch.
@@ -93,10 +93,10 @@ extern "C"{
 #define    IODAL_MAX_OCU_CHANNELS_HW_VAR_0            1U
 #define    IODAL_MAX_OCU_DESCRIPTORS                1U
     
-#define    IODAL_MAX_ICU_CHANNELS_HW_VAR_0            0U
-#define    IODAL_MAX_ICU_DESCRIPTORS                0U
+#define    IODAL_MAX_ICU_CHANNELS_HW_VAR_0            1U
+#define    IODAL_MAX_ICU_DESCRIPTORS                1U
     
-#define    IODAL_MAX_CHANNELS_HW_VAR_0                11U
+#define    IODAL_MAX_CHANNELS_HW_VAR_0                12U
 
 #define    IODAL_MAX_HW_VARIANTS                    1U
 
@@ -118,11 +118,35 @@ extern "C"{
 #define    IoDAL_PMW2        (8U)
 #define    IoDAL_PWM0        (9U)
 #define    IoDAL_DIGITAL_KEY2        (10U)
+#define    IoDAL_TACH_CAPTURE        (11U)
 
 #define IODAL_PWM_EXT_DEV          (STD_OFF)
-#define IODAL_PWM_SYNC             (STD_OFF)      
+#define IODAL_PWM_SYNC             (STD_ON)      
+/* IODAL_PWM_SYNC_OUTPUT duties staged during the cycle and committed by IoDal_FlushOutputs, one Pwm_SyncUpdate per FTM */
+#define IODAL_PWM_SYNC_BATCH       (STD_ON)
+/* DWT cycles and Pwm driver calls spent per cycle on IODAL_PWM_SYNC_OUTPUT channels, see IoDal_PwmSyncBenchmark */
+#define IODAL_PWM_SYNC_BENCHMARK   (STD_OFF)
 #define IODAL_DIO_EXT_DEV          (STD_OFF)
+/* Digital inputs served from a port snapshot taken by IoDal_SampleInputs instead of one Dio_ReadChannel per read */
+#define IODAL_DIO_INPUT_SNAPSHOT   (STD_ON)
+/* Digital outputs collected per port and written by IoDal_FlushOutputs with one Dio_MaskedWritePort per port */
+#define IODAL_DIO_OUTPUT_BATCH     (STD_ON)
+/* Digital inputs with EdgeEvent set latch their edges from the PORT pin interrupt, see IoDal_ReadInputEvent */
+#define IODAL_DIO_INPUT_EVENT      (STD_ON)
+/* The edges of the event inputs are reported to SysDal as wakeup events, see WakeUpNotification */
+#define IODAL_DIO_EDGE_WAKEUP      (STD_ON)
 #define IODAL_VARIABLE_PERIOD      (STD_OFF)
+#define IODAL_ANI_DEFERRED_READ    (STD_ON)
+/* IoDal_MainFunction periods without a complete hardware triggered scan before the analog inputs are invalid */
+#define IODAL_ANI_HW_SCAN_TIMEOUT  (2U)
+/* Timestamped history of the analog conversions, read in bulk with IoDal_ReadInputHistory */
+#define IODAL_ANI_HISTORY          (STD_ON)
+/* History entries per analog descriptor, power of two */
+#define IODAL_ANI_HISTORY_SIZE     (32U)
+/* Timestamps per input capture channel, circular buffer filled by the Icu driver (DMA) */
+#define IODAL_ICU_TIMESTAMP_BUFFER_SIZE  (16U)
+/* Timestamps between two Icu notifications, a whole buffer: one DMA completion interrupt per buffer round */
+#define IODAL_ICU_TIMESTAMP_NOTIFY       (IODAL_ICU_TIMESTAMP_BUFFER_SIZE)
 
 extern void IoDal_AdcBufferSetup(void);
 extern const IoDal_BswIoConfigType IoDal_Config[IODAL_MAX_HW_VARIANTS];
@@ -46,6 +46,8 @@ extern "C"{
 
 #define IFWK_USE_DIO
 
+#define IFWK_USE_ICU
+
 
 #ifdef IFWK_USE_DIO
     #include "Dio.h"
@@ -54,6 +56,19 @@ extern "C"{
 
 #ifdef IFWK_USE_ADC
     #include "Adc.h"
+
+    /* Analog inputs converted by the LPIT/TRGMUX/PDB triggered Adc group AdcAniScanGroup,
+       instead of the OCU software trigger table */
+    #define IODAL_ANI_HW_TRIGGER    (STD_OFF)
+
+    /* Per descriptor oversampling, decimation and IIR filter stage, IoDal_Ani_ReadInputs returns
+       the filtered value with the extra resolution bits of the descriptor filter configuration */
+    #define IODAL_ANI_FILTER        (STD_ON)
+
+    #if (IODAL_ANI_HW_TRIGGER == STD_ON)
+        #include "CDD_Mcl.h"
+        #include "Gpt.h"
+    #endif
 #endif
 
 #ifdef IFWK_USE_PWM
@@ -63,6 +78,10 @@ extern "C"{
 #ifdef IFWK_USE_OCU
     #include "Ocu.h"
 #endif    
+
+#ifdef IFWK_USE_ICU
+    #include "Icu.h"
+#endif
     
 /*==================================================================================================
                                          INCLUDE FILES
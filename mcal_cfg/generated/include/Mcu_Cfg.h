@@ -203,6 +203,22 @@ extern "C"{
 #define MCU_NO_PLL   (STD_OFF)
 
 
+/**
+* @brief            Clock tree of the RUN mode: SOSC -> SPLL -> core clock (SCG_RCCR).
+* @details          Field values as written to SCG_SPLLCFG and SCG_RCCR by the clock configuration.
+*/
+#define MCU_SOSC_FREQUENCY_HZ        (8000000UL)
+#define MCU_SPLL_PREDIV              (0UL)
+#define MCU_SPLL_MULT                (24UL)
+#define MCU_RUN_DIVCORE              (1UL)
+
+
+/**
+* @brief            Core clock of the RUN mode in Hz, SPLL_CLK = SOSC / (PREDIV + 1) * (MULT + 16) / 2.
+*/
+#define MCU_CORE_CLOCK_FREQUENCY_HZ  (((MCU_SOSC_FREQUENCY_HZ / (MCU_SPLL_PREDIV + 1UL)) * (MCU_SPLL_MULT + 16UL) / 2UL) / (MCU_RUN_DIVCORE + 1UL))
+
+
 /**
 * @brief            Number of available CMU units.
 */
@@ -220,7 +236,7 @@ extern "C"{
 *                   If this parameter has been configured to 'TRUE', the function 'Mcu_SetMode()' shall not be impacted and behave as specified.
 * @requirements     PR-MCAL-3184
 */
-#define MCU_ENTER_LOW_POWER_MODE   (STD_OFF)
+#define MCU_ENTER_LOW_POWER_MODE   (STD_ON)
 
 
 /**
@@ -338,7 +354,7 @@ extern "C"{
 /**
 * @brief            Maximum number of MCU Mode configurations.
 */
-#define MCU_MAX_MODECONFIGS   ((uint32)1U)
+#define MCU_MAX_MODECONFIGS   ((uint32)2U)
 
 
 /**
@@ -551,6 +567,10 @@ typedef struct
 #define McuModeSettingConf_0   ((Mcu_ModeType)0U)
 /** @violates @ref Mcu_CFG_H_REF_4 MISRA 2004 Required Rule 1.4 */
 #define McuConf_McuModeSettingConf_McuModeSettingConf_0   ((Mcu_ModeType)0U)
+/** @violates @ref Mcu_CFG_H_REF_4 MISRA 2004 Required Rule 1.4 */
+#define McuModeSettingConf_1   ((Mcu_ModeType)1U)
+/** @violates @ref Mcu_CFG_H_REF_4 MISRA 2004 Required Rule 1.4 */
+#define McuConf_McuModeSettingConf_McuModeSettingConf_1   ((Mcu_ModeType)1U)
 
 
 /**
@@ -680,6 +680,8 @@ extern "C" {
 #define PortConfigSet_PortContainer_0_PortPin_XTAL  5
 /** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
 #define PortConfigSet_PortContainer_0_PortPin_DIG_KEY2  16
+/** @violates @ref PORT_CFG_H_REF_1 The used compilers use more than 31 chars for identifiers. */
+#define PortConfigSet_PortContainer_0_PortPin_ICU_CAPT  17
 
 
 /**
@@ -700,12 +702,12 @@ extern "C" {
 /**
 * @brief The maximum number of configured pins
 */
-#define PORT_MAX_CONFIGURED_PADS_U16                        ((uint16)17)
+#define PORT_MAX_CONFIGURED_PADS_U16                        ((uint16)18)
 
 /**
  * @brief Number of UnUsed pin array
 */
-#define PORT_MAX_UNUSED_PADS_U16   (72U)
+#define PORT_MAX_UNUSED_PADS_U16   (71U)
 
 /**
 * @brief Port driver Post-build configuration switch
@@ -313,19 +313,19 @@ extern "C" {
 * @brief      Switch to indicate that Pwm_SyncUpdate API is supported
 *
 */
-#define PWM_SYNC_UPDATE_API                    (STD_OFF)
+#define PWM_SYNC_UPDATE_API                    (STD_ON)
 
 /**
 * @brief      Switch to indicate that the notifications are supported
 *
 */
-#define PWM_UPDATE_DUTY_SYNCHRONOUS       (STD_OFF)
+#define PWM_UPDATE_DUTY_SYNCHRONOUS       (STD_ON)
 
 /**
 * @brief      Switch to indicate that PwmSetDutyCycle_NoUpdate API is supported
 *
 */
-#define PWM_SET_DUTY_CYCLE_NO_UPDATE_API       (STD_OFF)
+#define PWM_SET_DUTY_CYCLE_NO_UPDATE_API       (STD_ON)
 
 
 /**
@@ -84,8 +84,20 @@ extern "C"{
 
 #define SWCRTE_USE_RTE_BUFFERS            (SWCRTE_STD_OFF)  
 
+/*Lighting sensor and actuator ports double buffered, written in place and read through a const pointer*/
+#define SWCRTE_DOUBLE_BUFFERED_PORTS      (SWCRTE_STD_ON)  
+
+/*Sensor and actuator ports served by the accessors generated in SwcRte_Ports.h, constant IoDal channel ids and no lookup*/
+#define SWCRTE_GENERATED_PORTS            (SWCRTE_STD_ON)  
+
+/*DWT cycles of the generated ports against the SwcRte_ReadInputs / SwcRte_WriteOutputs path, see SwcRte_PortBenchmark*/
+#define SWCRTE_PORT_BENCHMARK             (SWCRTE_STD_OFF)  
+
 #define SWCRTE_SINGLE_TASK_APPLICATION   (SWCRTE_STD_ON)  
 
+/*SwcRte_MainRunnable activates each runnable of SwcRte_RunnableSchedulePB at its own period and offset*/
+#define SWCRTE_MULTI_RATE                 (SWCRTE_STD_ON)  
+
 
 
 #define SWCRTE_MAX_LIGHTING_CHANNELS        2U
@@ -100,20 +112,46 @@ extern "C"{
 
 #define SWCRTE_MAX_APP_INSTANCES            (SWCRTE_MAX_LIGHTING_INSTANCES + SWCRTE_MAX_MOTORCTRL_INSTANCES + SWCRTE_MAX_VDR_INSTANCES)    
 
-#define SWCLIGHTING_MAXIMUM_ANALOG_FDBK_VALUE   3000U 
-#define SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE   500U
+/*largest u8NoInputChannel of all instances*/
+#define SWCRTE_MAX_INPUT_CHANNELS           1U
+
+/*entries of SwcRte_RunnableSchedulePB: Sensors, Lighting and Lighting feedback of each instance, Actuators*/
+#define SWCRTE_MAX_RUNNABLES                8U
+
+/*feedback limits at the 14 bit resolution of the IoDal analog filter stage*/
+#define SWCLIGHTING_MAXIMUM_ANALOG_FDBK_VALUE   12000U 
+#define SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE   2000U
+
+/*PWM outputs mapped from brightness to duty cycle through the SwcRte_LightingGammaLutPB dimming curve*/
+#define SWCLIGHTING_GAMMA_CORRECTION            (SWCRTE_STD_ON)
+#define SWCLIGHTING_GAMMA_LUT_POINTS            17U
+
+/*PWM outputs ramped to a new brightness over SWCLIGHTING_FADE_TICKS runs of SwcLighting_MainRunnable*/
+#define SWCLIGHTING_FADE                        (SWCRTE_STD_ON)
+#define SWCLIGHTING_FADE_TICKS                  8U
 
 
 
 #define SWCRTE_MAX_ANSENS_INSTANCES         1
 #define SWCRTE_MAX_DISENS_INSTANCES         2
+/*digital sensors debounced from the edges latched by IoDal (IODAL_DIO_INPUT_EVENT) instead of sampled every cycle*/
+#define SWCRTE_DIGITAL_SENS_EVENT           (SWCRTE_STD_ON)
+/*at least one instance debounces its digital sensors with SWCRTE_DEBOUNCE_VERTICAL*/
+#define SWCRTE_VERTICAL_DEBOUNCE            (SWCRTE_STD_ON)
 
-#define SWCRTE_ADC_RESOLUTION               12U	
+#define SWCRTE_ADC_RESOLUTION               14U	
 
 #define SWCRTE_USE_IODAL       (SWCRTE_STD_ON) 
 
 #define SWCRTE_USE_SYSDAL     (SWCRTE_STD_ON) 
 
+/*SysDal sleep mode requested once all lighting outputs stayed off for SWCRTE_SLEEP_DELAY runs of SwcRte_MainRunnable,
+  only if every lighting instance is controlled by a digital key (wakeup source)*/
+#define SWCRTE_SLEEP_REQUEST  (SWCRTE_STD_ON) 
+#define SWCRTE_SLEEP_DELAY    500U
+/*SysDal mode user of the RTE, below SYSDAL_USERS*/
+#define SWCRTE_SYSDAL_USER_ID 0U
+
 #define SWCRTE_USE_MEMDAL    (SWCRTE_STD_OFF) 
 
 #define SWCRTE_USE_COMDAL    (SWCRTE_STD_OFF) 
@@ -192,6 +230,14 @@ typedef struct
 ==================================================================================================*/
 extern const SwcRte_GlobalConfigType SwcRte_AppInstanceMapPB[SWCRTE_MAX_APP_INSTANCES];
 
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+extern const SwcRte_RunnableScheduleType SwcRte_RunnableSchedulePB[SWCRTE_MAX_RUNNABLES];
+#endif
+
+#if (SWCLIGHTING_GAMMA_CORRECTION == SWCRTE_STD_ON)
+extern const uint16_t SwcRte_LightingGammaLutPB[SWCLIGHTING_GAMMA_LUT_POINTS];
+#endif
+
 
 
 
@@ -0,0 +1,247 @@
+/**
+*   @file    SwcRte_Ports.h
+*   @version 1.0.1
+*
+*   @brief   Integration Framework - SWC RTE generated port accessors
+*   @details One accessor per sensor and actuator port of SwcRte_PBcfg.c, the IoDal channel id and the IoDal
+*            handler of the port are resolved at generation time. Included by SwcRte.c only.
+*
+*   @addtogroup SWCRTE
+*   @{
+*/
+/*===================================================================================================================
+*   Platform             : ARM
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*
+*   SW Version           : 1.0.1
+*   Build Version        : S32K14x_MCAL_1_0_1_RTM_ASR_REL_4_2_REV_0002_20170831
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2018 NXP
+*
+*   All Rights Reserved.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+====================================================================================================================*/
+/*===================================================================================================================
+====================================================================================================================*/
+#ifndef SWCRTE_PORTS_H
+#define SWCRTE_PORTS_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+                                         INCLUDE FILES
+ 1) system and project includes
+ 2) needed interfaces from external units
+ 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "SwcRte_Types.h"
+#include "SwcRte_Cfg.h"
+#include "IoDal.h"
+#include "IoDal_Ani.h"
+#include "IoDal_Dio.h"
+#include "IoDal_Pwm.h"
+
+/*===================================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+====================================================================================================================*/
+
+#define SWCRTE_PORTS_VENDOR_ID                    43
+
+#define SWCRTE_PORTS_SW_MAJOR_VERSION             1
+#define SWCRTE_PORTS_SW_MINOR_VERSION             0
+#define SWCRTE_PORTS_SW_PATCH_VERSION             1
+
+/*===================================================================================================================
+*                                     FILE VERSION CHECKS
+====================================================================================================================*/
+/* Check if SwcRte_Ports.h header file and SwcRte_Cfg.h header file are of the same vendor */
+#if (SWCRTE_PORTS_VENDOR_ID != SWCRTE_CFG_VENDOR_ID)
+    #error "SwcRte_Ports.h and SwcRte_Cfg.h have different vendor ids"
+#endif
+
+/* Check if SwcRte_Ports.h header file and SwcRte_Cfg.h header file are of the same Software version */
+#if ((SWCRTE_PORTS_SW_MAJOR_VERSION != SWCRTE_CFG_SW_MAJOR_VERSION) || \
+     (SWCRTE_PORTS_SW_MINOR_VERSION != SWCRTE_CFG_SW_MINOR_VERSION) || \
+     (SWCRTE_PORTS_SW_PATCH_VERSION != SWCRTE_CFG_SW_PATCH_VERSION))
+    #error "Software Version Numbers of SwcRte_Ports.h and SwcRte_Cfg.h are different"
+#endif
+
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+/* The accessors below index the port arrays with the instance and channel ids of the configuration they
+   were generated from, a configuration with other dimensions needs the file to be generated again */
+#if ((SWCRTE_MAX_APP_INSTANCES != 3U) || (SWCRTE_MAX_LIGHTING_INSTANCES != 3U) || \
+     (SWCRTE_MAX_INPUT_CHANNELS != 1U) || (SWCRTE_MAX_LIGHTING_CHANNELS < 2U))
+    #error "SwcRte_Ports.h was generated for 3 lighting instances with 1 input and up to 2 output channels"
+#endif
+
+/*==================================================================================================
+                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief   Converts the result of an IoDal input read to the RTE sensor value, as SwcRte_ReadInputs.
+*/
+static inline void SwcRte_Port_StoreInput(SwcRte_AppInputValueType * InputValue, Std_ReturnType RetVal, IoDal_BswValueType IoDalInputValue)
+{
+    if (E_OK == RetVal)
+    {
+        InputValue->Status = SWCRTE_MEAS_OK;
+        InputValue->Value = (uint16)IoDalInputValue;
+    }
+    else
+    {
+        InputValue->Status = SWCRTE_MEAS_NOT_OK;
+        InputValue->Value = 0U;
+    }
+}
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+/**
+* @brief   Converts the result of an IoDal input event read to the RTE sensor event, as SwcRte_ReadInputEvent.
+*/
+static inline void SwcRte_Port_StoreInputEvent(SwcRte_AppInputEventType * InputEvent, Std_ReturnType RetVal, const IoDal_InputEventType * IoDalInputEvent)
+{
+    if (E_OK == RetVal)
+    {
+        InputEvent->Status = SWCRTE_MEAS_OK;
+        InputEvent->bEdgeDetected = (TRUE == IoDalInputEvent->EdgeDetected) ? SWCRTE_TRUE : SWCRTE_FALSE;
+        InputEvent->u32EdgeAge = IoDalInputEvent->EdgeAge;
+        InputEvent->Value = (uint16)IoDalInputEvent->Level;
+    }
+    else
+    {
+        InputEvent->Status = SWCRTE_MEAS_NOT_OK;
+        InputEvent->bEdgeDetected = SWCRTE_FALSE;
+        InputEvent->u32EdgeAge = 0U;
+        InputEvent->Value = 0U;
+    }
+}
+#endif
+
+/*==================================================================================================
+                                   LIGHTING INSTANCE 0 PORTS
+==================================================================================================*/
+
+/*Sensor channel 0: IoDAL_AN_POT, SWCRTE_ANALOG_POT_SENS*/
+static inline void SwcRte_Port_Lighting0_ReadSensor0(SwcRte_AppInputValueType * InputValue)
+{
+    IoDal_BswValueType IoDalInputValue = 0U;
+
+    SwcRte_Port_StoreInput(InputValue, IoDal_Ani_ReadInputs(IoDAL_AN_POT, &IoDalInputValue), IoDalInputValue);
+}
+
+/*Output channel 0: IoDAL_PMW1*/
+static inline void SwcRte_Port_Lighting0_WriteOutput0(SwcRte_OutputValueType OutputValue)
+{
+    IoDal_Pwm_WriteDuty(IoDAL_PMW1, (IoDal_BswDutyType)OutputValue);
+}
+
+/*==================================================================================================
+                                   LIGHTING INSTANCE 1 PORTS
+==================================================================================================*/
+
+/*Sensor channel 0: IoDAL_DIGITAL_KEY2, SWCRTE_DIGITAL_SENS, SWCRTE_DEBOUNCE_VERTICAL*/
+static inline void SwcRte_Port_Lighting1_ReadSensor0(SwcRte_AppInputValueType * InputValue)
+{
+    IoDal_BswValueType IoDalInputValue = 0U;
+
+    SwcRte_Port_StoreInput(InputValue, IoDal_Dio_ReadInputs(IoDAL_DIGITAL_KEY2, &IoDalInputValue), IoDalInputValue);
+}
+
+/*Output channel 0: IoDAL_DOUT0*/
+static inline void SwcRte_Port_Lighting1_WriteOutput0(SwcRte_OutputValueType OutputValue)
+{
+    IoDal_Dio_WriteOutputs(IoDAL_DOUT0, (IoDal_BswValueType)OutputValue);
+}
+
+/*Output channel 1: IoDAL_DOUT1*/
+static inline void SwcRte_Port_Lighting1_WriteOutput1(SwcRte_OutputValueType OutputValue)
+{
+    IoDal_Dio_WriteOutputs(IoDAL_DOUT1, (IoDal_BswValueType)OutputValue);
+}
+
+/*==================================================================================================
+                                   LIGHTING INSTANCE 2 PORTS
+==================================================================================================*/
+
+/*Sensor channel 0: IoDAL_DIGITAL_KEY, SWCRTE_DIGITAL_SENS*/
+static inline void SwcRte_Port_Lighting2_ReadSensor0(SwcRte_AppInputValueType * InputValue)
+{
+    IoDal_BswValueType IoDalInputValue = 0U;
+
+    SwcRte_Port_StoreInput(InputValue, IoDal_Dio_ReadInputs(IoDAL_DIGITAL_KEY, &IoDalInputValue), IoDalInputValue);
+}
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+static inline void SwcRte_Port_Lighting2_ReadSensorEvent0(SwcRte_AppInputEventType * InputEvent)
+{
+    IoDal_InputEventType IoDalInputEvent;
+
+    SwcRte_Port_StoreInputEvent(InputEvent, IoDal_Dio_ReadInputEvent(IoDAL_DIGITAL_KEY, &IoDalInputEvent), &IoDalInputEvent);
+}
+#endif
+
+/*Output channel 0: IoDAL_PWM0*/
+static inline void SwcRte_Port_Lighting2_WriteOutput0(SwcRte_OutputValueType OutputValue)
+{
+    IoDal_Pwm_WriteDuty(IoDAL_PWM0, (IoDal_BswDutyType)OutputValue);
+}
+
+/*==================================================================================================
+                                       ALL PORTS
+==================================================================================================*/
+
+/**
+* @brief   Reads every sampled sensor port, digital sensors debounced with SWCRTE_DEBOUNCE_COUNTER are read by
+*          SwcRte_Port_ReadSensorEvents when SWCRTE_DIGITAL_SENS_EVENT is enabled and their entries are left unchanged.
+*/
+static inline void SwcRte_Port_ReadSensors(SwcRte_AppInputValueType InputValue[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS])
+{
+    SwcRte_Port_Lighting0_ReadSensor0(&InputValue[0][0]);
+    SwcRte_Port_Lighting1_ReadSensor0(&InputValue[1][0]);
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_OFF)
+    SwcRte_Port_Lighting2_ReadSensor0(&InputValue[2][0]);
+#endif
+}
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+/**
+* @brief   Reads the latched edge of every digital sensor port debounced with SWCRTE_DEBOUNCE_COUNTER, other
+*          entries are left unchanged.
+*/
+static inline void SwcRte_Port_ReadSensorEvents(SwcRte_AppInputEventType InputEvent[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS])
+{
+    SwcRte_Port_Lighting2_ReadSensorEvent0(&InputEvent[2][0]);
+}
+#endif
+
+/**
+* @brief   Writes the published output request of every lighting instance to its actuator ports.
+*/
+static inline void SwcRte_Port_WriteActuators(void)
+{
+    const AppLightingActuatorValueType * pOutputRequest;
+
+    pOutputRequest = SwcRte_GetLightingOutputRequest(0U);
+    SwcRte_Port_Lighting0_WriteOutput0(pOutputRequest->aLightingOutputIntesity[0]);
+
+    pOutputRequest = SwcRte_GetLightingOutputRequest(1U);
+    SwcRte_Port_Lighting1_WriteOutput0(pOutputRequest->aLightingOutputIntesity[0]);
+    SwcRte_Port_Lighting1_WriteOutput1(pOutputRequest->aLightingOutputIntesity[1]);
+
+    pOutputRequest = SwcRte_GetLightingOutputRequest(2U);
+    SwcRte_Port_Lighting2_WriteOutput0(pOutputRequest->aLightingOutputIntesity[0]);
+}
+#endif /*SWCRTE_GENERATED_PORTS*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*SWCRTE_PORTS_H*/
@@ -78,14 +78,47 @@ extern "C"{
     #error "Software Version Numbers of SysDal_Cfg.h and Std_Types.h are different"
 #endif
 
-#define SYSDAL_LOW_POWER_MODE(STD_OFF)
+#define SYSDAL_LOW_POWER_MODE               (STD_ON)
+#define SYSDAL_WAKEUP_LATENCY               (STD_ON)
+#define SYSDAL_MCU_RUN_MODE                 McuModeSettingConf_0
+#define SYSDAL_MCU_SLEEP_MODE               McuModeSettingConf_1
+#define SYSDAL_FAST_BOOT                    (STD_ON)
+#define SYSDAL_BOOT_NUMBER_OF_STEPS         1U
+
+#define SYSDAL_DEFER_NUMBER_OF_QUEUES       2U
+#define SYSDAL_DEFER_QUEUE_SIZE             8U
+#define SYSDAL_DEFER_QUEUE_IODAL_ANI        0U
+#define SYSDAL_DEFER_QUEUE_INTSCH           1U
+
 #if defined(AUTOSAR_OS_NOT_USED)
 #define GPT_SCH_TICKS                       4000U
 #define SYSDAL_SCH_GPT_TIMER_CHANNEL        1U
 #define SYSDAL_USERS                        1U
+#define SYSDAL_INTSCH_TICKLESS_MODE         STD_ON
+#define SYSDAL_INTSCH_MAX_SLEEP_TICKS       0xFFFFU
+#define SYSDAL_INTSCH_USE_CHANGE_TIMEOUT    STD_OFF
+#define SYSDAL_INTSCH_STATISTICS            STD_ON
+#define SYSDAL_INTSCH_STAT_HISTOGRAM_BINS   16U
+#define SYSDAL_INTSCH_STAT_HISTOGRAM_SHIFT  12U
+/* largest QueueLimit of all tasks, activation timestamps kept per task */
+#define SYSDAL_INTSCH_MAX_QUEUE_LIMIT       2U
 #define INTAPP_TASK_2_ACTIVATION_TIME        10
 #define INTAPP_TASK_3_ACTIVATION_TIME        20
 #define INTAPP_PREHOOK_TASK_ACTIVATION_TIME        0
+#define INTAPP_TASK_2_OFFSET        0
+#define INTAPP_TASK_3_OFFSET        1
+#define INTAPP_TASK_2_BOOT_STAGE        SYSDAL_BOOT_CRITICAL
+#define INTAPP_TASK_3_BOOT_STAGE        SYSDAL_BOOT_COMPLETE
+#define INTAPP_TASK_2_DEADLINE_POLICY        SYSDAL_INTSCH_POLICY_QUEUE
+#define INTAPP_TASK_2_QUEUE_LIMIT        2U
+#define INTAPP_TASK_2_DEGRADED_RUNNABLE        NULL_PTR
+#define INTAPP_TASK_2_DEM_EVENT        DemConf_DemEventParameter_SYSDAL_E_TASK_2_DEADLINE
+#define INTAPP_TASK_3_DEADLINE_POLICY        SYSDAL_INTSCH_POLICY_SKIP
+#define INTAPP_TASK_3_QUEUE_LIMIT        0U
+#define INTAPP_TASK_3_DEGRADED_RUNNABLE        NULL_PTR
+#define INTAPP_TASK_3_DEM_EVENT        DemConf_DemEventParameter_SYSDAL_E_TASK_3_DEADLINE
+
+#define SYSDAL_INTSCH_HYPERPERIOD           20U
 
 #define    INTAPP_TASK_2_ENABLE    STD_ON
 #define    INTAPP_TASK_3_ENABLE    STD_ON
@@ -96,13 +129,124 @@ extern "C"{
 #define    INTAPP_TASK_6_ENABLE    STD_OFF
 #define    INTAPP_TASK_7_ENABLE    STD_OFF
 
+/* Scheduler tasks derived from the INTAPP_TASK_N_ENABLE switches, the enabled tasks are indexed
+   in INTAPP_TASK_N order, the lowest index has the highest priority */
+#if (INTAPP_TASK_1_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_1_USED               1U
+#define SYSDAL_INTSCH_TASK_1_PERIOD             INTAPP_TASK_1_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_1_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_1_ACTIVATION_TIME, INTAPP_TASK_1_OFFSET, SYSDAL_INTSCH_TASK_1_IDX)
+#define SYSDAL_INTSCH_TASK_1_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_1_ACTIVATION_TIME, INTAPP_TASK_1_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_1_USED               0U
+#define SYSDAL_INTSCH_TASK_1_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_1_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_1_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_2_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_2_USED               1U
+#define SYSDAL_INTSCH_TASK_2_PERIOD             INTAPP_TASK_2_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_2_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_2_ACTIVATION_TIME, INTAPP_TASK_2_OFFSET, SYSDAL_INTSCH_TASK_2_IDX)
+#define SYSDAL_INTSCH_TASK_2_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_2_ACTIVATION_TIME, INTAPP_TASK_2_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_2_USED               0U
+#define SYSDAL_INTSCH_TASK_2_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_2_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_2_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_3_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_3_USED               1U
+#define SYSDAL_INTSCH_TASK_3_PERIOD             INTAPP_TASK_3_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_3_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_3_ACTIVATION_TIME, INTAPP_TASK_3_OFFSET, SYSDAL_INTSCH_TASK_3_IDX)
+#define SYSDAL_INTSCH_TASK_3_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_3_ACTIVATION_TIME, INTAPP_TASK_3_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_3_USED               0U
+#define SYSDAL_INTSCH_TASK_3_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_3_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_3_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_4_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_4_USED               1U
+#define SYSDAL_INTSCH_TASK_4_PERIOD             INTAPP_TASK_4_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_4_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_4_ACTIVATION_TIME, INTAPP_TASK_4_OFFSET, SYSDAL_INTSCH_TASK_4_IDX)
+#define SYSDAL_INTSCH_TASK_4_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_4_ACTIVATION_TIME, INTAPP_TASK_4_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_4_USED               0U
+#define SYSDAL_INTSCH_TASK_4_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_4_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_4_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_5_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_5_USED               1U
+#define SYSDAL_INTSCH_TASK_5_PERIOD             INTAPP_TASK_5_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_5_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_5_ACTIVATION_TIME, INTAPP_TASK_5_OFFSET, SYSDAL_INTSCH_TASK_5_IDX)
+#define SYSDAL_INTSCH_TASK_5_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_5_ACTIVATION_TIME, INTAPP_TASK_5_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_5_USED               0U
+#define SYSDAL_INTSCH_TASK_5_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_5_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_5_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_6_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_6_USED               1U
+#define SYSDAL_INTSCH_TASK_6_PERIOD             INTAPP_TASK_6_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_6_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_6_ACTIVATION_TIME, INTAPP_TASK_6_OFFSET, SYSDAL_INTSCH_TASK_6_IDX)
+#define SYSDAL_INTSCH_TASK_6_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_6_ACTIVATION_TIME, INTAPP_TASK_6_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_6_USED               0U
+#define SYSDAL_INTSCH_TASK_6_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_6_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_6_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+#if (INTAPP_TASK_7_ENABLE == STD_ON)
+#define SYSDAL_INTSCH_TASK_7_USED               1U
+#define SYSDAL_INTSCH_TASK_7_PERIOD             INTAPP_TASK_7_ACTIVATION_TIME
+#define SYSDAL_INTSCH_TASK_7_FIRES(Tick)        SYSDAL_INTSCH_TASK_FIRES((Tick), INTAPP_TASK_7_ACTIVATION_TIME, INTAPP_TASK_7_OFFSET, SYSDAL_INTSCH_TASK_7_IDX)
+#define SYSDAL_INTSCH_TASK_7_DISTANCE(Tick)     SYSDAL_INTSCH_TASK_DISTANCE((Tick), INTAPP_TASK_7_ACTIVATION_TIME, INTAPP_TASK_7_OFFSET)
+#else
+#define SYSDAL_INTSCH_TASK_7_USED               0U
+#define SYSDAL_INTSCH_TASK_7_PERIOD             1U
+#define SYSDAL_INTSCH_TASK_7_FIRES(Tick)        0UL
+#define SYSDAL_INTSCH_TASK_7_DISTANCE(Tick)     SYSDAL_INTSCH_MAX_SLEEP_TICKS
+#endif
+
+#define SYSDAL_INTSCH_TASK_1_IDX                0U
+#define SYSDAL_INTSCH_TASK_2_IDX                (SYSDAL_INTSCH_TASK_1_IDX + SYSDAL_INTSCH_TASK_1_USED)
+#define SYSDAL_INTSCH_TASK_3_IDX                (SYSDAL_INTSCH_TASK_2_IDX + SYSDAL_INTSCH_TASK_2_USED)
+#define SYSDAL_INTSCH_TASK_4_IDX                (SYSDAL_INTSCH_TASK_3_IDX + SYSDAL_INTSCH_TASK_3_USED)
+#define SYSDAL_INTSCH_TASK_5_IDX                (SYSDAL_INTSCH_TASK_4_IDX + SYSDAL_INTSCH_TASK_4_USED)
+#define SYSDAL_INTSCH_TASK_6_IDX                (SYSDAL_INTSCH_TASK_5_IDX + SYSDAL_INTSCH_TASK_5_USED)
+#define SYSDAL_INTSCH_TASK_7_IDX                (SYSDAL_INTSCH_TASK_6_IDX + SYSDAL_INTSCH_TASK_6_USED)
+#define SYSDAL_INTSCH_NUMBER_OF_TASKS           (SYSDAL_INTSCH_TASK_7_IDX + SYSDAL_INTSCH_TASK_7_USED)
+
+/* Ticks is a multiple of the activation time of all enabled tasks */
+#define SYSDAL_INTSCH_COMMON_MULTIPLE(Ticks) \
+    ((((Ticks) % SYSDAL_INTSCH_TASK_1_PERIOD) == 0U) && (((Ticks) % SYSDAL_INTSCH_TASK_2_PERIOD) == 0U) && \
+     (((Ticks) % SYSDAL_INTSCH_TASK_3_PERIOD) == 0U) && (((Ticks) % SYSDAL_INTSCH_TASK_4_PERIOD) == 0U) && \
+     (((Ticks) % SYSDAL_INTSCH_TASK_5_PERIOD) == 0U) && (((Ticks) % SYSDAL_INTSCH_TASK_6_PERIOD) == 0U) && \
+     (((Ticks) % SYSDAL_INTSCH_TASK_7_PERIOD) == 0U))
+
+#define SYSDAL_INTSCH_TICK_READY_MASK(Tick) \
+    (SYSDAL_INTSCH_TASK_1_FIRES(Tick) | SYSDAL_INTSCH_TASK_2_FIRES(Tick) | SYSDAL_INTSCH_TASK_3_FIRES(Tick) | \
+     SYSDAL_INTSCH_TASK_4_FIRES(Tick) | SYSDAL_INTSCH_TASK_5_FIRES(Tick) | SYSDAL_INTSCH_TASK_6_FIRES(Tick) | \
+     SYSDAL_INTSCH_TASK_7_FIRES(Tick))
+#define SYSDAL_INTSCH_TICK_NEXT_TICKS(Tick) \
+    SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_TASK_1_DISTANCE(Tick), SYSDAL_INTSCH_TASK_2_DISTANCE(Tick)), \
+                                        SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_TASK_3_DISTANCE(Tick), SYSDAL_INTSCH_TASK_4_DISTANCE(Tick))), \
+                      SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_MIN(SYSDAL_INTSCH_TASK_5_DISTANCE(Tick), SYSDAL_INTSCH_TASK_6_DISTANCE(Tick)), \
+                                        SYSDAL_INTSCH_TASK_7_DISTANCE(Tick)))
+
 
 extern void INTAPP_TASK_2(void);
 extern void INTAPP_TASK_3(void);
 extern void INTAPP_PREHOOK_TASK(void);
 #endif
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
+FUNC (void, SAMPLE_APP_CODE)SysDal_EarlyDriverInit(void);
+FUNC (void, SAMPLE_APP_CODE)SysDal_CriticalDriverInit(void);
+#else
 FUNC (void, SAMPLE_APP_CODE)SysDal_AllDriverInit(void);
+#endif
 FUNC (void, SAMPLE_APP_CODE)SysDal_SetAllProgrammableInterrupts(void);
 FUNC (void, SAMPLE_APP_CODE) SysDal_AllDriverDeinit(void);
 #if (SYSDAL_LOW_POWER_MODE == STD_ON)  
@@ -157,7 +157,7 @@ extern "C" {
 /** 
 * @brief This constant used for other modules to check if ICU is present in the project.  
 */
-#define USE_ICU_MODULE              (STD_OFF)
+#define USE_ICU_MODULE              (STD_ON)
 
 /** 
 * @brief This constant used for other modules to check if I2C is present in the project.  
@@ -172,7 +172,7 @@ extern "C"{
 * @brief          Total number of groups in Config.
 *
 */
-#define ADC_GROUPS           3
+#define ADC_GROUPS           4
 
 
 /*==================================================================================================
@@ -190,6 +190,7 @@ extern "C"{
 * @details       ADC Notification functions defined inside the Plugin.
 *
 */
+extern void IoDal_Ani_AdcHwScanNotification(void);
 
 
 
@@ -238,6 +239,27 @@ static CONST(Adc_ChannelType, ADC_CONST) Adc_Group2_Assignment_0[ADC_CFGSET_GROU
 {
     2U
 };
+/**
+* @brief          Group 3 Assignments on ADC Hardware unit 0.
+*
+*/
+static CONST(Adc_ChannelType, ADC_CONST) Adc_Group3_Assignment_0[ADC_CFGSET_GROUP_3_CHANNELS] =
+{
+    0U,
+    1U,
+    2U
+};
+
+#if (STD_ON==ADC_HW_TRIGGER_API)
+/**
+* @brief          Group 3 hardware trigger resource on ADC Hardware unit 0: PDB0 trigger input 0 (TRGMUX).
+*
+*/
+static CONST(Adc_HwTriggerTimerType, ADC_CONST) Adc_Group3_HwResource_0[1] =
+{
+    0U
+};
+#endif /* (STD_ON==ADC_HW_TRIGGER_API) */
 
 
 /**
@@ -370,6 +392,7 @@ static CONST(Adc_Adc12bsarv2_ChannelConfigurationType, ADC_CONST) Adc_ChannelsCf
 */
 static P2VAR(Adc_ValueGroupType, ADC_VAR, ADC_APPL_DATA) Adc_aResultsBufferPtr[] =
 {
+    NULL_PTR,
     NULL_PTR,
     NULL_PTR,
     NULL_PTR
@@ -657,6 +680,89 @@ static CONST(Adc_GroupConfigurationType, ADC_CONST) Adc_GroupsCfg[] =
         ,
         (uint16)0
 #endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
+        ,
+        /**< @brief Enables or disables the usage of limit checking for an ADC group. */
+        (boolean)STD_OFF
+#endif /* (STD_ON == ADC_ENABLE_LIMIT_CHECK) */
+    },
+    /**< @brief Group3 -- Hardware Unit ADC0 */
+    {
+        /**< @brief Hardware unit configured */
+        (Adc_HwUnitType)0,
+        /**< @brief Access mode */
+        ADC_ACCESS_MODE_SINGLE,
+        /**< @brief Conversion mode */
+        ADC_CONV_MODE_ONESHOT,
+        /**< @brief Conversion type */
+        ADC_CONV_TYPE_NORMAL,
+#if (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE)
+        /**< @brief Priority configured */
+        ((Adc_GroupPriorityType)(0U)),
+#endif
+        /**< @brief Replacement mode */
+        ADC_GROUP_REPL_ABORT_RESTART,
+        /**< @brief Trigger source configured */
+        ADC_TRIGG_SRC_HW,
+#if (STD_ON==ADC_HW_TRIGGER_API)
+        /**< @brief Hardware trigger signal */
+        ADC_HW_TRIG_RISING_EDGE,
+        /**< @brief Hardware resource for the group*/
+        Adc_Group3_HwResource_0,
+#endif /* (STD_ON==ADC_HW_TRIGGER_API) */
+#if (STD_ON==ADC_GRP_NOTIF_CAPABILITY)
+        /**< @brief Notification function */
+
+        &IoDal_Ani_AdcHwScanNotification,
+#endif /* (STD_ON==ADC_GRP_NOTIF_CAPABILITY) */
+#if (ADC_ENABLE_INITIAL_NOTIFICATION == STD_ON)
+        /**< @brief Extra notification function */
+
+        NULL_PTR,
+#endif
+        /**< @brief ADC Group Result Buffers RAM array */
+        Adc_aResultsBufferPtr,
+        /**< @brief Group Streaming Buffer Mode */
+        ADC_STREAM_BUFFER_LINEAR,
+        /**< @brief Number of streaming samples */
+        ((Adc_StreamNumSampleType)(1)),
+        /**< @brief Channels assigned to the group*/
+        Adc_Group3_Assignment_0,
+        /**< @brief Channel Delays assigned to the group*/
+        NULL_PTR,
+        /**< @brief Number of channels in the group*/
+        (Adc_ChannelIndexType)ADC_CFGSET_GROUP_3_CHANNELS,
+#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
+         /* Group Normal Conversion Timings */
+        2UL,
+        (uint32)(ADC12BSARV2_SC3_AVGE_DIS_U32 | ADC12BSARV2_SC3_AVGS_4_SAMPLES_U32),
+        ADC12BSARV2_CFG1_CLOCK_DIV1_U32,
+         /* Group Alternate Conversion Timings */
+        #if (ADC_DUAL_CLOCK_MODE == STD_ON)
+        2UL,
+        (uint32)(ADC12BSARV2_SC3_AVGE_DIS_U32 | ADC12BSARV2_SC3_AVGS_4_SAMPLES_U32),
+        ADC12BSARV2_CFG1_CLOCK_DIV1_U32,
+        #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+#endif /* (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE) */
+        /**< @brief Enables or Disables the ADC Back to Back configuration for Group channels */  
+        (uint8)STD_ON,
+        /**< @brief Enables or Disables the ADC pre-trigger delay configuration for each Group Channel */
+        (uint8)STD_OFF,
+        /**< @brief Enables or Disables the ADC and DMA interrupts */
+        (uint8)STD_OFF
+#if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
+        ,
+        /**< @brief Enables or Disables the ADC double buffering feature */
+        (boolean)STD_OFF,
+        /**< @brief Enable/disable half interrupt  for group with double bufferring*/
+        (boolean)STD_OFF
+#endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
+        ,
+        (uint16)0
+#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
+        ,
+        (uint16)0
+#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
         ,
         /**< @brief Enables or disables the usage of limit checking for an ADC group. */
@@ -691,7 +797,7 @@ CONST(Adc_ConfigType, ADC_CONST) AdcConfigSet =
 
         },
         /**< @brief number of the maximum groups in the current configuration */
-        3U,
+        4U,
         /**< @brief number of the maximum hardware units in the current configuration */
         1U,
         {
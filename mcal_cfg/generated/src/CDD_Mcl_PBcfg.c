@@ -196,6 +196,8 @@ extern "C"
 #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
 /* DMA Channel Transfer Completion Notifications */
     
+/** @violates @ref Mcl_PBcfg_REF_11 MISRA 2004 Rule 8.8 */
+    extern FUNC(void, MCL_CODE)IcuTimestampCapture_MclDmaTransferCompletionNotif(void);
 #endif
 
 /* DMA error notifications */
@@ -320,9 +322,9 @@ static CONST( Mcl_DmaMuxChannelConfigType, MCL_CONST) Mcl_DmaMux_ChannelConfig[M
         /** @brief DMAMUX instance used */
         DMA_MUX_0,
         /** @brief DMAMUX_CHCFGn register configuration */
-        (uint8)((DMAMUX_CHANNEL_DIS_U32) |
+        (uint8)((DMAMUX_CHANNEL_EN_U32) |
         (DMAMUX_CHANNEL_TRIG_DIS_U32) |
-        (0U))
+        (MCL_DMA_MUX_0_FTM3_CH_0_7))
     }
 
 };
@@ -353,7 +355,7 @@ CONST(Mcl_ChannelConfigType, MCL_CONST) Mcl_ChannelConfig[MCL_DMA_CONF_CHANNELS_
         DMA_HW_CHANNEL_0,
 #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
         /** @brief DMA notification function */
-        NULL_PTR
+        IcuTimestampCapture_MclDmaTransferCompletionNotif
 #endif
   /**  @violates @ref Mcl_PBcfg_REF_9 MISRA 2004 Rule 16.9, function identifier */
     }
@@ -418,6 +420,61 @@ CONST( Mcl_DmaInitConfigType, MCL_CONST) Mcl_Dma_InitConfig=
 
  
 
+#if (MCL_ENABLE_TRGMUX == STD_ON)
+/**
+* @brief            TrgMux basic configuration.
+* @details          All TRGMUX outputs start disconnected, the IoDal hardware triggered analog scan routes
+*                   its LPIT channel to PDB0 at runtime through Mcl_TrgMuxConfigInput().
+*
+*/
+/** @violates @ref Mcl_PBcfg_REF_10 external ... could be made static */
+CONST( Mcl_TrgMuxConfigType, MCL_CONST) Mcl_TrgMux_Config =
+    {
+        /** @brief TRGMUX_DMAMUX0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_EXTOUT0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_EXTOUT1 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_ADC0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_ADC1 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_CMP0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_FTM0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_FTM1 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_FTM2 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_FTM3 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_PDB0 */
+        (Mcl_TrgMuxRegisterType)0U,
+#ifdef  MCL_TRGMUX_PDB1_AVAILABLE
+        /** @brief TRGMUX_PDB1 */
+        (Mcl_TrgMuxRegisterType)0U,
+#endif
+        /** @brief TRGMUX_FLEXIO */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPIT0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPUART0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPUART1 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPI2C0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPSPI0 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPSPI1 */
+        (Mcl_TrgMuxRegisterType)0U,
+        /** @brief TRGMUX_LPTMR0 */
+        (Mcl_TrgMuxRegisterType)0U
+    };
+#endif /* (MCL_ENABLE_TRGMUX == STD_ON) */
+
 /**
 * @brief            Mcl basic configuration.
 * @details          Configuration for Mcl.
@@ -436,6 +493,11 @@ CONST( Mcl_ConfigType, MCL_CONST) MclConfigSet_0 =
 #endif        
         /** Configuration for the Dma and DmaMu IPs */
         &Mcl_Dma_InitConfig
+#if (MCL_ENABLE_TRGMUX == STD_ON)
+        ,
+        /** Configuration for the TrgMux IP */
+        &Mcl_TrgMux_Config
+#endif
          
 
     
@@ -106,7 +106,12 @@ extern "C"{
                                         LOCAL MACROS
 ==================================================================================================*/
 
-#define    IODAL_MAX_CHANNELS_HW_VAR_0                11U
+#define    IODAL_MAX_CHANNELS_HW_VAR_0                12U
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+#define    IODAL_ANALOG_CHANNEL_TYPE_HW_VAR_0         IODAL_ANALOG_HW_TRIG
+#else
+#define    IODAL_ANALOG_CHANNEL_TYPE_HW_VAR_0         IODAL_ANALOG_SW_TRIG
+#endif
 
 /*==================================================================================================
                                       FILE VERSION CHECKS
@@ -121,9 +126,14 @@ extern "C"{
 /*==================================================================================================
                                        LOCAL VARIABLES
 ==================================================================================================*/
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+/*Result buffer of the hardware triggered scan, one entry per channel of AdcAniScanGroup*/
+static Adc_ValueGroupType IoDal_AniDescriptor_AdcAniScanGroup_HW_VAR_0[3]    =    {0};
+#else
 static Adc_ValueGroupType IoDal_AniDescriptor_AdcLedFdbkGroup0_HW_VAR_0[1]    =    {0};
 static Adc_ValueGroupType IoDal_AniDescriptor_AdcLedFdbkGroup1_HW_VAR_0[1]    =    {0};
 static Adc_ValueGroupType IoDal_AniDescriptor_AdcPotGroup_HW_VAR_0[1]    =    {0};
+#endif
 
 /*==================================================================================================
                                        LOCAL CONSTANTS
@@ -147,6 +157,21 @@ static Adc_ValueGroupType IoDal_AniDescriptor_AdcPotGroup_HW_VAR_0[1]    =    {0
 static CONST(uint16, IODAL_CONST) IoDal_OcuTimeTable_TimeTriggerTable_0_HW_VAR_0[3] = {6250, 12500, 3000};
 
 /*SYNC PWM HW CONFIGURATIONS*/
+#if IODAL_MAX_PWM_CHANNELS_HW_VAR_0 > 0U
+/*FTM0: PwmChannel_0 (FTM_0_CH_0) and PwmChannel_1 (FTM_0_CH_1)*/
+static CONST(IoDal_InternalPwmConfig, IODAL_CONST) IoDal_SyncPwm_FTM_0_HW_VAR_0 =
+{
+    0U,                     /*FTM module*/
+    0x0003U                 /*Synced FTM channels*/
+};
+
+/*FTM2: PwmChannel_2 (FTM_2_CH_0)*/
+static CONST(IoDal_InternalPwmConfig, IODAL_CONST) IoDal_SyncPwm_FTM_2_HW_VAR_0 =
+{
+    2U,                     /*FTM module*/
+    0x0001U                 /*Synced FTM channels*/
+};
+#endif
 
 
 #if IODAL_MAX_DIO_CHANNELS_HW_VAR_0 > 0U
@@ -156,24 +181,28 @@ static CONST(IoDal_DigitalDescriptorType, IODAL_CONST) IoDal_DioChannelDescripto
     {
         DioConf_DioChannel_Dio_Key1,        /*DIO Channel ID*/
         STD_LOW,
+        TRUE,            /*Edge event*/
         NULL_PTR                /*External Device*/
     },
  
     {
         DioConf_DioChannel_DioChannel_1,        /*DIO Channel ID*/
         STD_LOW,
+        FALSE,           /*Edge event*/
         NULL_PTR                /*External Device*/
     },
  
     {
         DioConf_DioChannel_DioChannel_2,        /*DIO Channel ID*/
         STD_LOW,
+        FALSE,           /*Edge event*/
         NULL_PTR                /*External Device*/
     },
  
     {
         DioConf_DioChannel_Dio_Key2,        /*DIO Channel ID*/
         STD_LOW,
+        FALSE,           /*Edge event*/
         NULL_PTR                /*External Device*/
     }
 };
@@ -184,19 +213,19 @@ static CONST(IoDal_PwmDescriptorType, IODAL_CONST) IoDal_PwmChannelDescriptor_HW
 { 
     {
         PwmChannel_1,        /*PWM Channel ID*/ 
-        NULL_PTR,                /*Sync FTM not used. No additional configuration required*/
+        &IoDal_SyncPwm_FTM_0_HW_VAR_0,    /*Sync FTM configuration*/
         NULL_PTR                /*External Device*/
     },
  
     {
         PwmChannel_2,        /*PWM Channel ID*/ 
-        NULL_PTR,                /*Sync FTM not used. No additional configuration required*/
+        &IoDal_SyncPwm_FTM_2_HW_VAR_0,    /*Sync FTM configuration*/
         NULL_PTR                /*External Device*/
     },
  
     {
         PwmChannel_0,        /*PWM Channel ID*/ 
-        NULL_PTR,                /*Sync FTM not used. No additional configuration required*/
+        &IoDal_SyncPwm_FTM_0_HW_VAR_0,    /*Sync FTM configuration*/
         NULL_PTR                /*External Device*/
     }
 };
@@ -206,6 +235,29 @@ static CONST(IoDal_PwmDescriptorType, IODAL_CONST) IoDal_PwmChannelDescriptor_HW
 /*Analog Channel descriptor*/
 static CONST(IoDal_AnalogDescriptorType, IODAL_CONST) IoDal_AdcChannelDescriptor_HW_VAR_0[IODAL_MAX_ANALOG_CHANNELS_HW_VAR_0] =
 { 
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+    {
+        AdcAniScanGroup,        /*ADC Group ID*/     
+        0,         /*ADC Channel Position in the ADC AdcAniScanGroup Group definition*/
+        0,        /*ADC Conversion Time(in ticks), not used by HW trigger*/
+        IoDal_AniDescriptor_AdcAniScanGroup_HW_VAR_0,    /**ADC result data array */
+        0    /*Time trigger entry index, not used by HW trigger*/            
+    },
+    {
+        AdcAniScanGroup,        /*ADC Group ID*/     
+        1,         /*ADC Channel Position in the ADC AdcAniScanGroup Group definition*/
+        0,        /*ADC Conversion Time(in ticks), not used by HW trigger*/
+        IoDal_AniDescriptor_AdcAniScanGroup_HW_VAR_0,    /**ADC result data array */
+        0    /*Time trigger entry index, not used by HW trigger*/            
+    },
+    {
+        AdcAniScanGroup,        /*ADC Group ID*/     
+        2,         /*ADC Channel Position in the ADC AdcAniScanGroup Group definition*/
+        0,        /*ADC Conversion Time(in ticks), not used by HW trigger*/
+        IoDal_AniDescriptor_AdcAniScanGroup_HW_VAR_0,    /**ADC result data array */
+        0    /*Time trigger entry index, not used by HW trigger*/            
+    }
+#else
     {
         AdcLedFdbkGroup0,        /*ADC Group ID*/     
         0,         /*ADC Channel Position in the ADC AdcLedFdbkGroup0 Group definition*/
@@ -229,14 +281,54 @@ static CONST(IoDal_AnalogDescriptorType, IODAL_CONST) IoDal_AdcChannelDescriptor
         IoDal_AniDescriptor_AdcPotGroup_HW_VAR_0,    /**ADC result data array */
         0    /*Time trigger entry index within IoDal_OcuTimeTable_*_HW_VAR_0*/            
     }
-
+#endif
+};
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+/*Hardware triggered scan: LPIT0 channel 0 timeout -> TRGMUX -> PDB0 -> ADC0 AdcAniScanGroup*/
+static CONST(IoDal_AnalogHwTriggerType, IODAL_CONST) IoDal_AdcHwTrigger_HW_VAR_0 =
+{
+    AdcAniScanGroup,        /*Hardware triggered ADC Group ID*/
+    MCL_TRGMUX_PDB0_REG,        /*TRGMUX register of PDB0*/
+    MCL_TRGMUX_SEL_0,        /*PDB0 trigger input*/
+    MCL_TRGMUX_LPIT_CH0,        /*Trigger source*/
+    GptConf_GptChannelConfiguration_GptChannelConfiguration_WDG,        /*Gpt channel of LPIT0 channel 0*/
+    4000U        /*Scan period in Gpt ticks, one scan per scheduler tick (GPT_SCH_TICKS)*/
 };
 #endif
+#if (IODAL_ANI_FILTER == STD_ON)
+/*Analog filter stage, one entry per analog descriptor, all outputs with 2 extra bits (14 bit)*/
+static CONST(IoDal_AnalogFilterType, IODAL_CONST) IoDal_AniFilter_HW_VAR_0[IODAL_MAX_ANALOG_CHANNELS_HW_VAR_0] =
+{
+    {
+        2U,        /*Oversampling: 4 conversions per output*/
+        2U,        /*Extra resolution bits*/
+        0U         /*IIR disabled, short and open load are detected on the decimated value*/
+    },
+    {
+        2U,        /*Oversampling: 4 conversions per output*/
+        2U,        /*Extra resolution bits*/
+        0U         /*IIR disabled, short and open load are detected on the decimated value*/
+    },
+    {
+        4U,        /*Oversampling: 16 conversions per output*/
+        2U,        /*Extra resolution bits*/
+        2U         /*IIR time constant: 4 output samples*/
+    }
+};
+#endif
+#endif
 
 #if  IODAL_MAX_ICU_CHANNELS_HW_VAR_0 > 0U
 /*ICU Channel descriptor*/
 static CONST(IoDal_IcuDescriptorType, IODAL_CONST) IoDal_IcuChannelDescriptor_HW_VAR_0[IODAL_MAX_ICU_CHANNELS_HW_VAR_0] =
-{};
+{ 
+    {
+        IcuTimestampCapture,        /*ICU Channel ID*/
+        65536U,        /*Timer range of the FTM counter*/
+        TRUE,        /*Both edges timestamped: duty cycle measured*/
+        10U        /*Reads without an edge before the input is reported as stopped*/
+    }
+};
 #endif
 
 #if  IODAL_MAX_OCU_CHANNELS_HW_VAR_0 > 0U
@@ -260,17 +352,17 @@ static CONST(IoDal_BswChannelMapType, IODAL_CONST) IoDal_BswChannelMap_HW_VAR_0[
     },    
     /*IoDAL_AN_FBK_PWM0*/
     {
-        IODAL_ANALOG_SW_TRIG,        /*Datatype of current channel*/
+        IODAL_ANALOG_CHANNEL_TYPE_HW_VAR_0,        /*Datatype of current channel*/
         0        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_AN_FBK_PWM1*/
     {
-        IODAL_ANALOG_SW_TRIG,        /*Datatype of current channel*/
+        IODAL_ANALOG_CHANNEL_TYPE_HW_VAR_0,        /*Datatype of current channel*/
         1        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_AN_POT*/
     {
-        IODAL_ANALOG_SW_TRIG,        /*Datatype of current channel*/
+        IODAL_ANALOG_CHANNEL_TYPE_HW_VAR_0,        /*Datatype of current channel*/
         2        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_DIGITAL_KEY*/
@@ -290,23 +382,28 @@ static CONST(IoDal_BswChannelMapType, IODAL_CONST) IoDal_BswChannelMap_HW_VAR_0[
     },    
     /*IoDAL_PMW1*/
     {
-        IODAL_PWM_FIXED_PERIOD_OUTPUT,        /*Datatype of current channel*/
+        IODAL_PWM_SYNC_OUTPUT,        /*Datatype of current channel*/
         0        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_PMW2*/
     {
-        IODAL_PWM_FIXED_PERIOD_OUTPUT,        /*Datatype of current channel*/
+        IODAL_PWM_SYNC_OUTPUT,        /*Datatype of current channel*/
         1        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_PWM0*/
     {
-        IODAL_PWM_FIXED_PERIOD_OUTPUT,        /*Datatype of current channel*/
+        IODAL_PWM_SYNC_OUTPUT,        /*Datatype of current channel*/
         2        /*Index of current channel in own Datatype Channel Descriptor*/
     },    
     /*IoDAL_DIGITAL_KEY2*/
     {
         IODAL_DIO_INPUT,        /*Datatype of current channel*/
         3        /*Index of current channel in own Datatype Channel Descriptor*/
+    },    
+    /*IoDAL_TACH_CAPTURE*/
+    {
+        IODAL_TIMER_CAPTURE,        /*Datatype of current channel*/
+        0        /*Index of current channel in own Datatype Channel Descriptor*/
     }    
 };
 /*=====================================================================================================================*/
@@ -322,9 +419,13 @@ static CONST(IoDal_BswChannelMapType, IODAL_CONST) IoDal_BswChannelMap_HW_VAR_0[
 /*=====================================================================================================================*/
 FUNC(void, SAMPLE_APP_CODE) IoDal_AdcBufferSetup(void)
 {
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+    (void)Adc_SetupResultBuffer(AdcAniScanGroup, &IoDal_AniDescriptor_AdcAniScanGroup_HW_VAR_0[0]);
+#else
     (void)Adc_SetupResultBuffer(AdcLedFdbkGroup0, &IoDal_AniDescriptor_AdcLedFdbkGroup0_HW_VAR_0[0]);
     (void)Adc_SetupResultBuffer(AdcLedFdbkGroup1, &IoDal_AniDescriptor_AdcLedFdbkGroup1_HW_VAR_0[0]);
     (void)Adc_SetupResultBuffer(AdcPotGroup, &IoDal_AniDescriptor_AdcPotGroup_HW_VAR_0[0]);
+#endif
 }
 
 CONST(IoDal_BswIoConfigType, IODAL_CONST) IoDal_Config[IODAL_MAX_HW_VARIANTS] = 
@@ -335,10 +436,16 @@ CONST(IoDal_BswIoConfigType, IODAL_CONST) IoDal_Config[IODAL_MAX_HW_VARIANTS] =
         3, /*Number of Pwm channels*/
         4, /*Number of Digital channels*/
         1, /*Number of Output Compare  channels*/
-        0, /*Number of input Capture channels*/
+        1, /*Number of input Capture channels*/
 #if IODAL_MAX_ANALOG_CHANNELS_HW_VAR_0 > 0U
         IoDal_AdcChannelDescriptor_HW_VAR_0,
         &IoDal_AdcBufferSetup,
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+        &IoDal_AdcHwTrigger_HW_VAR_0,
+#endif
+#if (IODAL_ANI_FILTER == STD_ON)
+        IoDal_AniFilter_HW_VAR_0,
+#endif
 #endif
 #if IODAL_MAX_PWM_CHANNELS_HW_VAR_0 > 0U
         IoDal_PwmChannelDescriptor_HW_VAR_0,
@@ -331,7 +331,7 @@ static CONST(Mcu_RamConfigType, MCU_CONST) Mcu_Ram_ConfigPB0[1] =
 * @details      Specifies the system behaviour during the selected target mode.
 *               Configuration set by calling Mcu_SetMode() API.
 */
-static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[1] =
+static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[2] =
 {
 
     /* Start of Mcu_ModeConfig[0]*/
@@ -343,6 +343,16 @@ static CONST( Mcu_ModeConfigType, MCU_CONST) Mcu_Mode_ConfigPB0[1] =
         (Mcu_PowerModeType)MCU_RUN_MODE
     }
     /* end of Mcu_Mode_ConfigPB0[0]. */
+    ,
+    /* Start of Mcu_ModeConfig[1]*/
+    {
+        /* The ID for Power Mode configuration. */
+        (uint8)1U,
+        
+        /* Power Mode */
+        (Mcu_PowerModeType)MCU_VLPS_MODE
+    }
+    /* end of Mcu_Mode_ConfigPB0[1]. */
 
 };
 
@@ -500,8 +510,8 @@ static CONST( Mcu_SCG_RegisterConfigType, MCU_CONST) SPLL_ClockConfigPB0_0[MCU_N
     {
         SCG_SPLLCFG_ADDR32,
         (
-            SCG_SPLLCFG_PREDIV_U32((uint32)0U) |
-            SCG_SPLLCFG_MULT_U32((uint32)24U)
+            SCG_SPLLCFG_PREDIV_U32((uint32)MCU_SPLL_PREDIV) |
+            SCG_SPLLCFG_MULT_U32((uint32)MCU_SPLL_MULT)
         )
     },
     /* SCG_SPLLDIV settings. */
@@ -541,7 +551,7 @@ static CONST( Mcu_SCG_ClockConfigType, MCU_CONST) SCG_ClockConfigPB0_0 =
     /* Run Clock Config(SCG_RCCR) */
     (
         SCG_SCS_SPLL_U32 |
-        SCG_DIVCORE_U32((uint32)1U) |
+        SCG_DIVCORE_U32((uint32)MCU_RUN_DIVCORE) |
         SCG_DIVBUS_U32((uint32)1U) |
         SCG_DIVSLOW_U32((uint32)3U)
     ),
@@ -1180,7 +1190,7 @@ static CONST( Mcu_SMC_ConfigType, MCU_CONST) SMC_ConfigPB0 =
     /* Allowed modes */
     (
         SMC_PMPROT_HSRUN_ALLOWED_U32 |
-        SMC_PMPROT_VLP_NOT_ALLOWED_U32
+        SMC_PMPROT_VLP_ALLOWED_U32
     ),
 };
 
@@ -1227,7 +1237,7 @@ CONST(Mcu_ConfigType, MCU_CONST) McuModuleConfiguration =
     (Mcu_RamSectionType)1U,
 
     /* Number of Power Modes configurations. */
-    (Mcu_ModeType)1U,
+    (Mcu_ModeType)2U,
 
 #if (MCU_INIT_CLOCK == STD_ON)
     /* Number of Clock Setting configurations. */
@@ -226,7 +226,8 @@ const SwcRte_GlobalConfigType SwcRte_AppInstanceMapPB[SWCRTE_MAX_APP_INSTANCES]
         1,        /*Number of input channels*/
         1,    /*Number of output channels*/
         SwcRte_LightingInputChannelMap_0_PB,    /*Input channel map configuration structure*/
-        SwcRte_LightingOutputChannelMap_0_PB    /*Output channel map configuration structure*/
+        SwcRte_LightingOutputChannelMap_0_PB,    /*Output channel map configuration structure*/
+        SWCRTE_DEBOUNCE_COUNTER    /*Digital sensor debounce*/
     },    
     {
         SWCRTE_LIGHTING,        /*Application type*/
@@ -234,7 +235,8 @@ const SwcRte_GlobalConfigType SwcRte_AppInstanceMapPB[SWCRTE_MAX_APP_INSTANCES]
         1,        /*Number of input channels*/
         2,    /*Number of output channels*/
         SwcRte_LightingInputChannelMap_1_PB,    /*Input channel map configuration structure*/
-        SwcRte_LightingOutputChannelMap_1_PB    /*Output channel map configuration structure*/
+        SwcRte_LightingOutputChannelMap_1_PB,    /*Output channel map configuration structure*/
+        SWCRTE_DEBOUNCE_VERTICAL    /*Digital sensor debounce*/
     },    
     {
         SWCRTE_LIGHTING,        /*Application type*/
@@ -242,11 +244,77 @@ const SwcRte_GlobalConfigType SwcRte_AppInstanceMapPB[SWCRTE_MAX_APP_INSTANCES]
         1,        /*Number of input channels*/
         1,    /*Number of output channels*/
         SwcRte_LightingInputChannelMap_2_PB,    /*Input channel map configuration structure*/
-        SwcRte_LightingOutputChannelMap_2_PB    /*Output channel map configuration structure*/
+        SwcRte_LightingOutputChannelMap_2_PB,    /*Output channel map configuration structure*/
+        SWCRTE_DEBOUNCE_COUNTER    /*Digital sensor debounce*/
     }    
 
 };
 
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+/*runnables in execution order, period and offset in activations of SwcRte_MainRunnable (INTAPP_TASK_3)*/
+const SwcRte_RunnableScheduleType SwcRte_RunnableSchedulePB[SWCRTE_MAX_RUNNABLES] = 
+{
+    {
+        SWCRTE_SENSORS_RUNNABLE,        /*Runnable*/
+        0,        /*Instance*/
+        1,        /*Period*/
+        0         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_RUNNABLE,        /*Runnable*/
+        0,        /*Instance*/
+        1,        /*Period*/
+        0         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_RUNNABLE,        /*Runnable*/
+        1,        /*Instance*/
+        2,        /*Period*/
+        0         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_RUNNABLE,        /*Runnable*/
+        2,        /*Instance*/
+        2,        /*Period*/
+        1         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_FBK_RUNNABLE,        /*Runnable*/
+        0,        /*Instance*/
+        10,       /*Period*/
+        2         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_FBK_RUNNABLE,        /*Runnable*/
+        1,        /*Instance*/
+        10,       /*Period*/
+        5         /*Offset*/
+    },
+    {
+        SWCRTE_LIGHTING_FBK_RUNNABLE,        /*Runnable*/
+        2,        /*Instance*/
+        10,       /*Period*/
+        8         /*Offset*/
+    },
+    {
+        SWCRTE_ACTUATORS_RUNNABLE,        /*Runnable*/
+        0,        /*Instance*/
+        1,        /*Period*/
+        0         /*Offset*/
+    }
+};
+#endif
+
+#if (SWCLIGHTING_GAMMA_CORRECTION == SWCRTE_STD_ON)
+/*PWM duty cycle of brightness 0, 0x800, ... 0x8000, gamma 2.2*/
+const uint16_t SwcRte_LightingGammaLutPB[SWCLIGHTING_GAMMA_LUT_POINTS] = 
+{
+    0U,     74U,    338U,   824U,   1552U,  2536U,  3787U,  5316U,
+    7132U,  9241U,  11652U, 14370U, 17401U, 20752U, 24427U, 28431U,
+    32768U
+};
+#endif
+
 
 /*PostBuild configuration structure.*/
 /** @violates @ref SWCRTE_PBCFG_C_REF_4 Violates MISRA 2004 Required Rule 8.10 could be made static*/
@@ -36,6 +36,9 @@ extern "C"{
  3) internal and external interfaces from this unit
 ====================================================================================================================*/
 #include "SysDal.h"
+#if defined(AUTOSAR_OS_NOT_USED)
+#include "SysDal_IntSch.h"
+#endif
 /*===================================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
 ====================================================================================================================*/
@@ -51,6 +54,7 @@ extern "C"{
 #include "Port.h"
 #include "Adc.h"
 #include "Det.h"
+#include "Dem_IntErrId.h"
 #include "Gpt.h"
 #include "Ocu.h"
 #include "Pwm.h"
@@ -63,6 +67,12 @@ extern ISR (Adc_Adc12bsarv2_EndGroupConvUnit0);
 extern ISR (FTM_1_CH_0_CH_1_ISR);
 extern ISR (LPIT_0_CH_0_ISR);
 extern ISR (LPIT_0_CH_1_ISR);
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+extern ISR (IoDal_Dio_PortC_EdgeIsr);
+#endif
+#ifdef IFWK_USE_ICU
+extern ISR (MCL_DMA_CH_0_ISR);
+#endif
 
 FUNC(void, SAMPLE_APP_CODE)SysDal_SetAllProgrammableInterrupts(void)
 {
@@ -75,10 +85,61 @@ FUNC(void, SAMPLE_APP_CODE)SysDal_SetAllProgrammableInterrupts(void)
     sys_registerIsrHandler(48, (uint32) & LPIT_0_CH_0_ISR);
     sys_enableIsrSource(49, ((2) << 4));	
     sys_registerIsrHandler(49, (uint32) & LPIT_0_CH_1_ISR);
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+    /*PORTC: digital keys*/
+    sys_enableIsrSource(61, ((8) << 4));
+    sys_registerIsrHandler(61, (uint32) & IoDal_Dio_PortC_EdgeIsr);
+#endif
+#ifdef IFWK_USE_ICU
+    /*DMA0: the completion resets the Icu timestamp buffer before the next edge*/
+    sys_enableIsrSource(0, ((1) << 4));
+    sys_registerIsrHandler(0, (uint32) & MCL_DMA_CH_0_ISR);
+#endif
     sys_enableAllInterrupts();
 }
 #endif
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
+static FUNC (void, SAMPLE_APP_CODE)SysDal_BootStep_SwcRte(void);
+
+/*Dio has no init function, the DIO channels are usable once Port is initialised*/
+FUNC (void, SAMPLE_APP_CODE)SysDal_EarlyDriverInit(void)
+{
+    Port_Init(&PortConfigSet);
+    Det_Init();
+    Det_Start();
+}
+
+/*the drivers of the IoDal task (INTAPP_TASK_2), dispatched from SYSDAL_BOOT_CRITICAL on*/
+FUNC (void, SAMPLE_APP_CODE)SysDal_CriticalDriverInit(void)
+{
+    Gpt_Init(&GptChannelConfigSet);
+    Gpt_EnableNotification(1);
+    Adc_Init(&AdcConfigSet);
+#if (IODAL_ANI_HW_TRIGGER == STD_ON) || defined(IFWK_USE_ICU)
+    /*TRGMUX routing of the hardware triggered analog scan, eDMA channel of the Icu timestamps*/
+    Mcl_Init(&MclConfigSet_0);
+#endif
+#ifdef IFWK_USE_ICU
+    Icu_Init(&IcuConfigSet);
+#endif
+    Ocu_Init(&OcuConfigSet);
+    Pwm_Init(&PwmChannelConfigSet);
+    Pwm_SelectCommonTimebase(0, 3);
+    IoDal_Init(&IoDal_Config[0]);
+}
+
+static FUNC (void, SAMPLE_APP_CODE)SysDal_BootStep_SwcRte(void)
+{
+    SwcRte_Init(&SwcRte_AppInstanceMapPB[0]);
+}
+
+/*the application of INTAPP_TASK_3 is brought up in background, on top of the IoDal channels*/
+static const SysDal_CalloutType SysDal_BootStepConfig[SYSDAL_BOOT_NUMBER_OF_STEPS]=
+{
+    &SysDal_BootStep_SwcRte
+};
+#else
 FUNC (void, SAMPLE_APP_CODE)SysDal_AllDriverInit(void)
 {
     Port_Init(&PortConfigSet);
@@ -87,18 +148,42 @@ FUNC (void, SAMPLE_APP_CODE)SysDal_AllDriverInit(void)
     Det_Start();
     Gpt_Init(&GptChannelConfigSet);
     Gpt_EnableNotification(1);
+#if (IODAL_ANI_HW_TRIGGER == STD_ON) || defined(IFWK_USE_ICU)
+    /*TRGMUX routing of the hardware triggered analog scan, eDMA channel of the Icu timestamps*/
+    Mcl_Init(&MclConfigSet_0);
+#endif
+#ifdef IFWK_USE_ICU
+    Icu_Init(&IcuConfigSet);
+#endif
     Ocu_Init(&OcuConfigSet);
     Pwm_Init(&PwmChannelConfigSet);
     Pwm_SelectCommonTimebase(0, 3);
     IoDal_Init(&IoDal_Config[0]);
 }
+#endif
 
 #if (SYSDAL_LOW_POWER_MODE == STD_ON)
+#if (IODAL_DIO_INPUT_EVENT != STD_ON) || (IODAL_DIO_EDGE_WAKEUP != STD_ON)
+    #error "SYSDAL_LOW_POWER_MODE requires a wakeup source, the digital key edges are reported by IODAL_DIO_EDGE_WAKEUP"
+#endif
 FUNC (void, SAMPLE_APP_CODE)SysDal_SetWakeupEventsCallout(void)
 {
+#if defined(AUTOSAR_OS_NOT_USED)
+    /*only the wakeup sources may leave the sleep mode, PORTC (digital keys) is kept enabled*/
+    sys_disableIsrSource(39);
+    sys_disableIsrSource(105);
+    sys_disableIsrSource(48);
+    sys_disableIsrSource(49);
+#ifdef IFWK_USE_ICU
+    sys_disableIsrSource(0);
+#endif
+#endif
 }
 FUNC (void, SAMPLE_APP_CODE)SysDal_ClearWakeupEventsCallout(void)
 {
+#if defined(AUTOSAR_OS_NOT_USED)
+    SysDal_SetAllProgrammableInterrupts();
+#endif
 }
 #endif
 FUNC (void, SAMPLE_APP_CODE)SysDal_AllDriverDeinit(void)
@@ -116,18 +201,139 @@ void INTAPP_TASK_3(void)
 {
 
 SwcRte_MainRunnable();
+SysDal_MainFunction();
 
 }
 void INTAPP_PREHOOK_TASK(void)
 {
 
+#if (SYSDAL_FAST_BOOT == STD_OFF)
 SwcRte_Init(&SwcRte_AppInstanceMapPB[0]);
+#endif
 
 }
+
+#if (SYSDAL_FAST_BOOT == STD_ON)
+#define SYSDAL_INTSCH_TASK_CONFIG(Task) \
+    { \
+        &Task, Task##_ACTIVATION_TIME, Task##_OFFSET, \
+        Task##_DEADLINE_POLICY, Task##_QUEUE_LIMIT, Task##_DEGRADED_RUNNABLE, Task##_DEM_EVENT, \
+        Task##_BOOT_STAGE \
+    }
+#else
+#define SYSDAL_INTSCH_TASK_CONFIG(Task) \
+    { \
+        &Task, Task##_ACTIVATION_TIME, Task##_OFFSET, \
+        Task##_DEADLINE_POLICY, Task##_QUEUE_LIMIT, Task##_DEGRADED_RUNNABLE, Task##_DEM_EVENT \
+    }
+#endif
+
+/* one entry per enabled task, in the SYSDAL_INTSCH_TASK_N_IDX order of SysDal_Cfg.h */
+const SysDal_IntSch_TaskConfigType SysDal_IntSch_TaskConfig[SYSDAL_INTSCH_NUMBER_OF_TASKS]=
+{
+#if (INTAPP_TASK_1_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_1),
+#endif
+#if (INTAPP_TASK_2_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_2),
+#endif
+#if (INTAPP_TASK_3_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_3),
+#endif
+#if (INTAPP_TASK_4_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_4),
+#endif
+#if (INTAPP_TASK_5_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_5),
+#endif
+#if (INTAPP_TASK_6_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_6),
+#endif
+#if (INTAPP_TASK_7_ENABLE == STD_ON)
+    SYSDAL_INTSCH_TASK_CONFIG(INTAPP_TASK_7),
+#endif
+};
+
+#if (SYSDAL_INTSCH_MAX_QUEUE_LIMIT == 0U) || \
+    ((INTAPP_TASK_1_ENABLE == STD_ON) && (INTAPP_TASK_1_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_2_ENABLE == STD_ON) && (INTAPP_TASK_2_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_3_ENABLE == STD_ON) && (INTAPP_TASK_3_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_4_ENABLE == STD_ON) && (INTAPP_TASK_4_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_5_ENABLE == STD_ON) && (INTAPP_TASK_5_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_6_ENABLE == STD_ON) && (INTAPP_TASK_6_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT)) || \
+    ((INTAPP_TASK_7_ENABLE == STD_ON) && (INTAPP_TASK_7_QUEUE_LIMIT > SYSDAL_INTSCH_MAX_QUEUE_LIMIT))
+    #error "SYSDAL_INTSCH_MAX_QUEUE_LIMIT shall be at least 1 and not below the QUEUE_LIMIT of any task"
+#endif
+
+#if ((SYSDAL_INTSCH_HYPERPERIOD == 0U) || (SYSDAL_INTSCH_HYPERPERIOD > SYSDAL_INTSCH_MAX_HYPERPERIOD))
+    #error "SYSDAL_INTSCH_HYPERPERIOD is out of the range supported by the schedule table"
+#endif
+
+#if (!SYSDAL_INTSCH_COMMON_MULTIPLE(SYSDAL_INTSCH_HYPERPERIOD))
+    #error "SYSDAL_INTSCH_HYPERPERIOD is not a multiple of all task activation times"
+#endif
+
+/* A common multiple H is the least one when no proper divisor of H is a common multiple. If the LCM L
+   is below H, H/L has a prime factor p and H/p is a common multiple. For p up to 22 (the square root
+   of SYSDAL_INTSCH_MAX_HYPERPERIOD) H/p is checked directly. A larger p divides H only once, so
+   H/p is a divisor of H of at most 22, checked as the small divisors d of H. */
+#define SYSDAL_INTSCH_REDUCIBLE_BY(p) \
+    (((SYSDAL_INTSCH_HYPERPERIOD % (p)) == 0U) && SYSDAL_INTSCH_COMMON_MULTIPLE(SYSDAL_INTSCH_HYPERPERIOD / (p)))
+#define SYSDAL_INTSCH_SMALL_DIVISOR(d) \
+    (((d) < SYSDAL_INTSCH_HYPERPERIOD) && ((SYSDAL_INTSCH_HYPERPERIOD % (d)) == 0U) && SYSDAL_INTSCH_COMMON_MULTIPLE(d))
+#if SYSDAL_INTSCH_REDUCIBLE_BY(2U) || SYSDAL_INTSCH_REDUCIBLE_BY(3U) || SYSDAL_INTSCH_REDUCIBLE_BY(5U) || \
+    SYSDAL_INTSCH_REDUCIBLE_BY(7U) || SYSDAL_INTSCH_REDUCIBLE_BY(11U) || SYSDAL_INTSCH_REDUCIBLE_BY(13U) || \
+    SYSDAL_INTSCH_REDUCIBLE_BY(17U) || SYSDAL_INTSCH_REDUCIBLE_BY(19U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(1U) || SYSDAL_INTSCH_SMALL_DIVISOR(2U) || SYSDAL_INTSCH_SMALL_DIVISOR(3U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(4U) || SYSDAL_INTSCH_SMALL_DIVISOR(5U) || SYSDAL_INTSCH_SMALL_DIVISOR(6U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(7U) || SYSDAL_INTSCH_SMALL_DIVISOR(8U) || SYSDAL_INTSCH_SMALL_DIVISOR(9U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(10U) || SYSDAL_INTSCH_SMALL_DIVISOR(11U) || SYSDAL_INTSCH_SMALL_DIVISOR(12U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(13U) || SYSDAL_INTSCH_SMALL_DIVISOR(14U) || SYSDAL_INTSCH_SMALL_DIVISOR(15U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(16U) || SYSDAL_INTSCH_SMALL_DIVISOR(17U) || SYSDAL_INTSCH_SMALL_DIVISOR(18U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(19U) || SYSDAL_INTSCH_SMALL_DIVISOR(20U) || SYSDAL_INTSCH_SMALL_DIVISOR(21U) || \
+    SYSDAL_INTSCH_SMALL_DIVISOR(22U)
+    #error "SYSDAL_INTSCH_HYPERPERIOD is not the least common multiple of the task activation times"
+#endif
+
+/* one entry per tick of the hyperperiod */
+const SysDal_IntSch_ScheduleEntryType SysDal_IntSch_ScheduleTable[SYSDAL_INTSCH_HYPERPERIOD]=
+{
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 256U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_256(0U)
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 128U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_128((SYSDAL_INTSCH_HYPERPERIOD & 0x100U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 64U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_64((SYSDAL_INTSCH_HYPERPERIOD & 0x180U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 32U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_32((SYSDAL_INTSCH_HYPERPERIOD & 0x1C0U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 16U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_16((SYSDAL_INTSCH_HYPERPERIOD & 0x1E0U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 8U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_8((SYSDAL_INTSCH_HYPERPERIOD & 0x1F0U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 4U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_4((SYSDAL_INTSCH_HYPERPERIOD & 0x1F8U))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 2U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_2((SYSDAL_INTSCH_HYPERPERIOD & 0x1FCU))
+#endif
+#if (0U != (SYSDAL_INTSCH_HYPERPERIOD & 1U))
+    SYSDAL_INTSCH_SCHEDULE_ENTRIES_1((SYSDAL_INTSCH_HYPERPERIOD & 0x1FEU))
+#endif
+};
 #endif
 const SysDal_ConfigType SysDal_Config=
 {
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    &SysDal_CriticalDriverInit,
+#else
     &SysDal_AllDriverInit,
+#endif
     &SysDal_SetAllProgrammableInterrupts,
     &SysDal_AllDriverDeinit
 #if (SYSDAL_LOW_POWER_MODE == STD_ON)     
@@ -135,6 +341,11 @@ const SysDal_ConfigType SysDal_Config=
     &SysDal_SetWakeupEventsCallout,
     &SysDal_ClearWakeupEventsCallout
 #endif
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    ,
+    &SysDal_EarlyDriverInit,
+    &SysDal_BootStepConfig[0]
+#endif
 };
 
 #ifdef __cplusplus
@@ -207,6 +207,29 @@ extern "C"{
 #endif
 
 
+/*===================================================================================================================
+                                                 LOCAL MACROS
+====================================================================================================================*/
+/* Channel types needing work in IoDal_MainFunction, each one gets its own dispatch list built by IoDal_Init */
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_DIO_EXT_DEV == STD_ON)
+#define IODAL_DIO_EXT_DEV_LIST              (STD_ON)
+#else
+#define IODAL_DIO_EXT_DEV_LIST              (STD_OFF)
+#endif
+
+#if (IODAL_MAX_PWM_DESCRIPTORS > 0U) && (IODAL_PWM_EXT_DEV == STD_ON)
+#define IODAL_PWM_EXT_DEV_LIST              (STD_ON)
+#else
+#define IODAL_PWM_EXT_DEV_LIST              (STD_OFF)
+#endif
+
+/* with IODAL_PWM_SYNC_BATCH the sync outputs are committed by IoDal_FlushOutputs, not by the main function */
+#if (IODAL_MAX_PWM_DESCRIPTORS > 0U) && (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_OFF)
+#define IODAL_PWM_RESYNC_LIST               (STD_ON)
+#else
+#define IODAL_PWM_RESYNC_LIST               (STD_OFF)
+#endif
+
 /*===================================================================================================================
                                    LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ====================================================================================================================*/
@@ -247,10 +270,44 @@ P2CONST(IoDal_BswIoConfigType, IODAL_VAR, IODAL_APP_CONST) IoDal_pGlobalCfgPtr =
 */
 static VAR(IoDal_ModuleStateType,      AUTOMATIC) IoDal_ModuleState = IODAL_UNINIT;
 
+/**
+* @brief          Number of BSW channels of the configuration, set by IoDal_Init.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_BswChannelCount = 0U;
+
+#if (IODAL_DIO_EXT_DEV_LIST == STD_ON)
+/**
+* @brief          IODAL_EXT_DEV_INPUT and IODAL_EXT_DEV_OUTPUT channels, served by IoDal_Dio_ExtDevHandler.
+*
+*/
+static VAR(IoDal_BswChannelIdType, AUTOMATIC) IoDal_DioExtDevChannel[IODAL_MAX_DIO_DESCRIPTORS];
+static VAR(uint8, AUTOMATIC) IoDal_DioExtDevCount = 0U;
+#endif
+
+#if (IODAL_PWM_EXT_DEV_LIST == STD_ON)
+/**
+* @brief          IODAL_PWM_EXT_DEV_OUTPUT channels, served by IoDal_Pwm_ExtDevHandler.
+*
+*/
+static VAR(IoDal_BswChannelIdType, AUTOMATIC) IoDal_PwmExtDevChannel[IODAL_MAX_PWM_DESCRIPTORS];
+static VAR(uint8, AUTOMATIC) IoDal_PwmExtDevCount = 0U;
+#endif
+
+#if (IODAL_PWM_RESYNC_LIST == STD_ON)
+/**
+* @brief          IODAL_PWM_SYNC_OUTPUT channels, served by IoDal_Pwm_OutputResync.
+*
+*/
+static VAR(IoDal_BswChannelIdType, AUTOMATIC) IoDal_PwmResyncChannel[IODAL_MAX_PWM_DESCRIPTORS];
+static VAR(uint8, AUTOMATIC) IoDal_PwmResyncCount = 0U;
+#endif
+
 /*===================================================================================================================
                                              LOCAL FUNCTION PROTOTYPES
 ====================================================================================================================*/
 static inline FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ValidateIoChannel(IoDal_BswChannelIdType BswIoChannel);
+static FUNC(void, IODAL_APP_CODE) IoDal_BuildDispatchLists(void);
 
 /*=====================================================================================================================
                                                  LOCAL FUNCTIONS
@@ -258,16 +315,108 @@ static inline FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ValidateIoChannel(IoDal
 static inline FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ValidateIoChannel(IoDal_BswChannelIdType BswIoChannel)
 {
     Std_ReturnType RetVal = E_OK;
-    uint8 MaxIoChannels =  IoDal_pGlobalCfgPtr->AdcDescriptorsCount + IoDal_pGlobalCfgPtr->PwmChannelCount + \
-                           IoDal_pGlobalCfgPtr->DioChannelCount  + IoDal_pGlobalCfgPtr->OcuChannelCount + \
-                           IoDal_pGlobalCfgPtr->IcuChannelCount;
                            
-    if(BswIoChannel > MaxIoChannels)
+    if(BswIoChannel > IoDal_BswChannelCount)
     {
         RetVal = E_NOT_OK;        
     }        
     return RetVal;
 }
+
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_BuildDispatchLists - Collects the channels served by IoDal_MainFunction
+@details    Most channel types need no cyclic work (DIO, SW triggered analog, fixed period PWM, and the HW triggered
+            analog channels which are supervised once per scan). Only the remaining channels are listed, one list
+            per handler, so the main function cost only depends on the channels that need it.
+            Channel types unknown to this configuration are reported once here.
+
+@return     void
+@retval     
+
+@pre        IoDal_pGlobalCfgPtr and IoDal_BswChannelCount are set
+@post None
+*/
+/*=====================================================================================================================*/
+static FUNC(void, IODAL_APP_CODE) IoDal_BuildDispatchLists(void)
+{
+    uint8 BswIoChannel;
+    IoDal_BswChannelType ChannelType;
+
+#if (IODAL_DIO_EXT_DEV_LIST == STD_ON)
+    IoDal_DioExtDevCount = 0U;
+#endif
+#if (IODAL_PWM_EXT_DEV_LIST == STD_ON)
+    IoDal_PwmExtDevCount = 0U;
+#endif
+#if (IODAL_PWM_RESYNC_LIST == STD_ON)
+    IoDal_PwmResyncCount = 0U;
+#endif
+
+    for (BswIoChannel = 0U;  BswIoChannel < IoDal_BswChannelCount; BswIoChannel++ )
+    {    
+        ChannelType = ((IoDal_pGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType;
+        
+        switch (ChannelType)
+        {
+#if IODAL_MAX_ANI_DESCRIPTORS > 0U                   
+            case IODAL_ANALOG_SW_TRIG:
+            case IODAL_ANALOG_HW_TRIG:
+            break;
+#endif                
+            
+#if IODAL_MAX_DIO_DESCRIPTORS > 0U                     
+            /*Dio write/read operations are asynchronous*/
+            case IODAL_DIO_INPUT:
+            case IODAL_DIO_OUTPUT:
+            break;                
+#if (IODAL_DIO_EXT_DEV == STD_ON)                 
+            case IODAL_EXT_DEV_INPUT:
+            case IODAL_EXT_DEV_OUTPUT:    
+            {                    
+                IoDal_DioExtDevChannel[IoDal_DioExtDevCount] = BswIoChannel;
+                IoDal_DioExtDevCount++;
+            }break;  
+#endif                
+#endif                
+            case IODAL_TIMER_CAPTURE:
+                /*edges timestamped by the Icu driver, period and duty computed when read*/
+            break;
+            
+            case IODAL_TIMER_OUTPUT:
+            break;
+            
+#if IODAL_MAX_PWM_DESCRIPTORS > 0U                    
+            case IODAL_PWM_VARIBLE_PERIOD_OUTPUT:
+            case IODAL_PWM_FIXED_PERIOD_OUTPUT: 
+            break;
+
+#if (IODAL_PWM_EXT_DEV == STD_ON)   
+            case IODAL_PWM_EXT_DEV_OUTPUT:
+            {
+                IoDal_PwmExtDevChannel[IoDal_PwmExtDevCount] = BswIoChannel;
+                IoDal_PwmExtDevCount++;
+            }break;
+#endif
+#if (IODAL_PWM_SYNC == STD_ON)   
+            case IODAL_PWM_SYNC_OUTPUT:                 
+            {
+#if (IODAL_PWM_RESYNC_LIST == STD_ON)
+                IoDal_PwmResyncChannel[IoDal_PwmResyncCount] = BswIoChannel;
+                IoDal_PwmResyncCount++;
+#endif
+            }break;    
+#endif    
+#endif       
+            default:
+            {
+#if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+                Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_INIT_API_ID, IODAL_E_INVALID_CHANNEL_TYPE);
+#endif            
+            }
+        }
+    }
+}
 /*=====================================================================================================================
                                                  GLOBAL FUNCTIONS
 =====================================================================================================================*/
@@ -294,6 +443,9 @@ FUNC(void, IODAL_APP_CODE) IoDal_Init(P2CONST(IoDal_BswIoConfigType, AUTOMATIC,
         if(NULL_PTR != ConfigPtr)
         {            
             IoDal_pGlobalCfgPtr = ConfigPtr;
+            IoDal_BswChannelCount = IoDal_pGlobalCfgPtr->AdcDescriptorsCount + IoDal_pGlobalCfgPtr->PwmChannelCount + \
+                                    IoDal_pGlobalCfgPtr->DioChannelCount  + IoDal_pGlobalCfgPtr->OcuChannelCount + \
+                                    IoDal_pGlobalCfgPtr->IcuChannelCount;
             
 #if IODAL_MAX_ANI_DESCRIPTORS > 0U
             /*initialize analog components if ADC channels are used */ 
@@ -319,6 +471,8 @@ FUNC(void, IODAL_APP_CODE) IoDal_Init(P2CONST(IoDal_BswIoConfigType, AUTOMATIC,
             }
 #endif            
             
+            IoDal_BuildDispatchLists();
+
             IoDal_ModuleState = IODAL_INIT;        
         }
         else
@@ -376,6 +530,16 @@ FUNC(void, IODAL_APP_CODE) IoDal_DeInit(void)
             IoDal_Dio_DeInit();
         }        
 #endif         
+#if (IODAL_DIO_EXT_DEV_LIST == STD_ON)
+        IoDal_DioExtDevCount = 0U;
+#endif
+#if (IODAL_PWM_EXT_DEV_LIST == STD_ON)
+        IoDal_PwmExtDevCount = 0U;
+#endif
+#if (IODAL_PWM_RESYNC_LIST == STD_ON)
+        IoDal_PwmResyncCount = 0U;
+#endif
+        IoDal_BswChannelCount = 0U;
         IoDal_pGlobalCfgPtr = NULL_PTR;
         
         IoDal_ModuleState = IODAL_DEINIT;
@@ -395,7 +559,8 @@ FUNC(void, IODAL_APP_CODE) IoDal_DeInit(void)
 /**
 @brief      IoDal_MainFunction - main function of the IODAL
 @details    This function shall be called cyclically from any BSW task and shall be used to handle synchronous 
-            input/output requests (PWM sync outputs, handling of SPI or I2C external IO devices)
+            input/output requests (PWM sync outputs, handling of SPI or I2C external IO devices).
+            Only the channels collected by IoDal_BuildDispatchLists are visited.
 
 @return     void
 @retval     
@@ -406,88 +571,282 @@ FUNC(void, IODAL_APP_CODE) IoDal_DeInit(void)
 /*=====================================================================================================================*/
 FUNC(void, IODAL_APP_CODE) IoDal_MainFunction(void)
 {
-    uint8 BswIoChannel;
-    IoDal_BswChannelType ChannelType;
-    uint8 MaxIoChannels =  IoDal_pGlobalCfgPtr->AdcDescriptorsCount + IoDal_pGlobalCfgPtr->PwmChannelCount + \
-                           IoDal_pGlobalCfgPtr->DioChannelCount  + IoDal_pGlobalCfgPtr->OcuChannelCount + \
-                           IoDal_pGlobalCfgPtr->IcuChannelCount;
+#if (IODAL_DIO_EXT_DEV_LIST == STD_ON) || (IODAL_PWM_EXT_DEV_LIST == STD_ON) || (IODAL_PWM_RESYNC_LIST == STD_ON)
+    uint8 ListIndex;
+#endif
     
     if (IODAL_INIT == IoDal_ModuleState)
     {
-        
-        for (BswIoChannel = 0U;  BswIoChannel < MaxIoChannels; BswIoChannel++ )
-        {    
-            ChannelType = ((IoDal_pGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType;
-            
-            switch (ChannelType)
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+        /*one supervision pass for the scan converting all IODAL_ANALOG_HW_TRIG channels*/
+        IoDal_Ani_AdcHwTriggerHandler();
+#endif
+
+#if (IODAL_DIO_EXT_DEV_LIST == STD_ON)
+        for (ListIndex = 0U; ListIndex < IoDal_DioExtDevCount; ListIndex++)
+        {
+            IoDal_Dio_ExtDevHandler(IoDal_DioExtDevChannel[ListIndex]);
+        }
+#endif
+
+#if (IODAL_PWM_EXT_DEV_LIST == STD_ON)
+        for (ListIndex = 0U; ListIndex < IoDal_PwmExtDevCount; ListIndex++)
+        {
+            IoDal_Pwm_ExtDevHandler(IoDal_PwmExtDevChannel[ListIndex]);
+        }
+#endif
+
+#if (IODAL_PWM_RESYNC_LIST == STD_ON)
+        for (ListIndex = 0U; ListIndex < IoDal_PwmResyncCount; ListIndex++)
+        {
+            IoDal_Pwm_OutputResync(IoDal_PwmResyncChannel[ListIndex]);
+        }
+#endif
+    }
+    else
+    {
+        /*call Det: module not initialized*/
+#if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_MAINFUNCTION_API_ID, IODAL_E_UNINIT);
+#endif    
+    }    
+}
+
+
+
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_ReadCapture - Read period and duty cycle of an input capture channel
+@details    The values are computed from the newest edge timestamps when this function is called, see
+            IoDal_Dio_ReadCapture. IoDal_ReadInputs returns the period only.
+
+@param[in]  BswIoChannel    Logical BSW input capture channel id.
+@param[out] CaptureValue    Measured signal.
+
+@return     Std_ReturnType
+@retval     E_OK            CaptureValue is valid.
+@retval     E_NOT_OK        No valid measurement yet or the request is invalid.
+
+@pre None
+@post None
+*/
+/*=====================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadCapture(IoDal_BswChannelIdType BswIoChannel, IoDal_CaptureValueType * CaptureValue)
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if (IODAL_INIT == IoDal_ModuleState)
+    {
+        if(NULL_PTR != CaptureValue)
+        {
+            if (E_OK == IoDal_ValidateIoChannel(BswIoChannel))
             {
-#if IODAL_MAX_ANI_DESCRIPTORS > 0U                   
-                case IODAL_ANALOG_SW_TRIG:
-                break;
-                
-                case IODAL_ANALOG_HW_TRIG:
+                if (IODAL_TIMER_CAPTURE == ((IoDal_pGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType)
                 {
-                    IoDal_Ani_AdcHwTriggerHandler();
-                }break;
-#endif                
-                
-#if IODAL_MAX_DIO_DESCRIPTORS > 0U                     
-                /*Dio write/read operations are asynchronous*/
-                case IODAL_DIO_INPUT:
-                case IODAL_DIO_OUTPUT:
-                break;                
-#if (IODAL_DIO_EXT_DEV == STD_ON)                 
-                case IODAL_EXT_DEV_INPUT:
-                case IODAL_EXT_DEV_OUTPUT:    
-                {                    
-                    IoDal_Dio_ExtDevHandler(BswIoChannel);
-                }break;  
-#endif                
-#endif                
-                case IODAL_TIMER_CAPTURE:
-                break;
-                
-                case IODAL_TIMER_OUTPUT:
-                break;
-                
-#if IODAL_MAX_PWM_DESCRIPTORS > 0U                    
-                /*Dio write/read operations are asynchronous*/
-                case IODAL_PWM_VARIBLE_PERIOD_OUTPUT:
-                case IODAL_PWM_FIXED_PERIOD_OUTPUT: 
-                break;
-   
-#if (IODAL_PWM_EXT_DEV == STD_ON)   
-                case IODAL_PWM_EXT_DEV_OUTPUT:
+                    RetVal = IoDal_Dio_ReadCapture(BswIoChannel, CaptureValue);
+                }
+                else
                 {
-                    IoDal_Pwm_ExtDevHandler(BswIoChannel);
-                }break;
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+                    Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READCAPTURE_API_ID, IODAL_E_INVALID_CHANNEL_TYPE);
+    #endif            
+                }
+            }
+            else
+            {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READCAPTURE_API_ID, IODAL_E_INVALID_CHANNEL_ID);
+    #endif    
+            }
+        }
+        else
+        {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READCAPTURE_API_ID, IODAL_E_PARAM_POINTER);
+    #endif            
+        }        
+    }
+    else
+    {
+        /*call Det: module not initialized*/
+#if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READCAPTURE_API_ID, IODAL_E_UNINIT);
+#endif    
+    }    
+    
+    return RetVal;
+}
 #endif
-#if (IODAL_PWM_SYNC == STD_ON)   
-                case IODAL_PWM_SYNC_OUTPUT:                 
+
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_DIO_INPUT_EVENT == STD_ON)
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_ReadInputEvent - Read and clear the latched edge of a digital input
+@details    Only digital inputs configured with EdgeEvent latch their edges, see IoDal_Dio_ReadInputEvent.
+            Without an edge the input does not need to be read or debounced.
+
+@param[in]  BswIoChannel    Logical BSW digital input channel id.
+@param[out] InputEvent      Edge and level of the input.
+
+@return     Std_ReturnType
+@retval     E_OK            InputEvent is valid.
+@retval     E_NOT_OK        The input is not an event input or the request is invalid.
+
+@pre None
+@post None
+*/
+/*=====================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputEvent(IoDal_BswChannelIdType BswIoChannel, IoDal_InputEventType * InputEvent)
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if (IODAL_INIT == IoDal_ModuleState)
+    {
+        if(NULL_PTR != InputEvent)
+        {
+            if (E_OK == IoDal_ValidateIoChannel(BswIoChannel))
+            {
+                if (IODAL_DIO_INPUT == ((IoDal_pGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType)
                 {
-                    IoDal_Pwm_OutputResync(BswIoChannel);                    
-                }break;    
-#endif    
-#endif       
-                default:
+                    RetVal = IoDal_Dio_ReadInputEvent(BswIoChannel, InputEvent);
+                }
+                else
                 {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+                    Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTEVENT_API_ID, IODAL_E_INVALID_CHANNEL_TYPE);
+    #endif            
+                }
+            }
+            else
+            {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTEVENT_API_ID, IODAL_E_INVALID_CHANNEL_ID);
+    #endif    
+            }
+        }
+        else
+        {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTEVENT_API_ID, IODAL_E_PARAM_POINTER);
+    #endif            
+        }        
+    }
+    else
+    {
+        /*call Det: module not initialized*/
 #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
-                    Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_MAINFUNCTION_API_ID, IODAL_E_INVALID_CHANNEL_TYPE);
-#endif            
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTEVENT_API_ID, IODAL_E_UNINIT);
+#endif    
+    }    
+    
+    return RetVal;
+}
+#endif
+
+#if (IODAL_MAX_ANI_DESCRIPTORS > 0U) && (IODAL_ANI_HISTORY == STD_ON)
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_ReadInputHistory - Read the timestamped sample history of an analog input
+@details    Returns all samples since *Cursor that are still stored, see IoDal_Ani_ReadHistory. Intended for
+            diagnostics that need every conversion, consumers of the latest value use IoDal_ReadInputs.
+            The timestamps are ticks of the Ocu counter of the analog trigger channel, with the software
+            and with the hardware trigger, see IoDal_AnalogSampleType.
+
+@param[in]     BswIoChannel    Logical BSW analog input channel id.
+@param[in,out] Cursor          Sequence number of the next sample to read, 0 after init.
+@param[out]    Samples         Caller buffer for the samples.
+@param[in,out] SampleCount     In: size of Samples, out: number of samples written to Samples.
+
+@return     Std_ReturnType
+@retval     E_OK            All samples since the cursor were returned or are still pending.
+@retval     E_NOT_OK        Samples were lost or the request is invalid.
+
+@pre None
+@post None
+*/
+/*=====================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputHistory(IoDal_BswChannelIdType BswIoChannel, IoDal_AnalogHistoryCursorType * Cursor, IoDal_AnalogSampleType * Samples, uint16 * SampleCount)
+{
+    IoDal_BswChannelType SensorType;
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if (IODAL_INIT == IoDal_ModuleState)
+    {
+        if((NULL_PTR != Cursor) && (NULL_PTR != Samples) && (NULL_PTR != SampleCount))
+        {    
+            if (E_OK == IoDal_ValidateIoChannel(BswIoChannel))
+            {
+                SensorType = ((IoDal_pGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType;
+
+                if ((IODAL_ANALOG_HW_TRIG == SensorType) || (IODAL_ANALOG_SW_TRIG == SensorType))
+                {
+                    RetVal = IoDal_Ani_ReadHistory(BswIoChannel, Cursor, Samples, SampleCount);
+                }
+                else
+                {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+                    Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTHISTORY_API_ID, IODAL_E_INVALID_CHANNEL_TYPE);
+    #endif            
                 }
             }
+            else
+            {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTHISTORY_API_ID, IODAL_E_INVALID_CHANNEL_ID);
+    #endif    
+            }
+        }
+        else
+        {
+    #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+            Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTHISTORY_API_ID, IODAL_E_PARAM_POINTER);
+    #endif            
         }        
     }
     else
     {
         /*call Det: module not initialized*/
 #if (IODAL_DEV_ERROR_DETECT == STD_ON)        
-        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_MAINFUNCTION_API_ID, IODAL_E_UNINIT);
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_READINPUTHISTORY_API_ID, IODAL_E_UNINIT);
 #endif    
     }    
+    
+    return RetVal;
 }
+#endif
 
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_SampleInputs - Latch the inputs read during the next cycle
+@details    Shall be called once per cycle by the consumer of the inputs (SWCRTE), before the first 
+            IoDal_ReadInputs of the cycle. With IODAL_DIO_INPUT_SNAPSHOT all IODAL_DIO_INPUT channels are 
+            sampled here together, one port read per port, and IoDal_ReadInputs returns the latched levels.
+            Without snapshot channels this function has no effect.
+
+@return     void
+@retval     
 
+@pre None
+@post None
+*/
+/*=====================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_SampleInputs(void)
+{
+    if (IODAL_INIT == IoDal_ModuleState)
+    {
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+        IoDal_Dio_SampleInputs();
+#endif
+    }
+    else
+    {
+        /*call Det: module not initialized*/
+#if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_SAMPLEINPUTS_API_ID, IODAL_E_UNINIT);
+#endif    
+    }    
+}
 
 /*=====================================================================================================================*/
 /**
@@ -523,8 +882,6 @@ FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputs(IoDal_BswChannelIdType Bsw
                 {
 #if IODAL_MAX_ANI_DESCRIPTORS > 0U    
                     case IODAL_ANALOG_HW_TRIG: 
-                    break;
-                    
                     case IODAL_ANALOG_SW_TRIG:
                     {
                        RetVal = IoDal_Ani_ReadInputs(BswIoChannel,   InputValue);                    
@@ -537,9 +894,12 @@ FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_ReadInputs(IoDal_BswChannelIdType Bsw
                        skipStupidOptimization++;
                     }break;    
 #endif
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_MAX_ICU_DESCRIPTORS > 0U)
                     case IODAL_TIMER_CAPTURE:
-                    break;
-                    
+                    {
+                       RetVal = IoDal_Dio_ReadInputs(BswIoChannel,  InputValue);
+                    }break;
+#endif
                     case IODAL_EXT_DEV_INPUT:
                     break;
                     
@@ -661,6 +1021,42 @@ FUNC(void, IODAL_APP_CODE) IoDal_WriteOutputs(IoDal_BswChannelIdType BswIoChanne
     }    
 }
 
+/*=====================================================================================================================*/
+/**
+@brief      IoDal_FlushOutputs - Apply the output commands written during the cycle
+@details    Shall be called once per cycle by the producer of the outputs (SWCRTE), after the last 
+            IoDal_WriteOutputs of the cycle and from the same task. With IODAL_DIO_OUTPUT_BATCH the IODAL_DIO_OUTPUT
+            channels written in the cycle are driven here, one masked port write per port. With IODAL_PWM_SYNC_BATCH
+            the duty cycles of the IODAL_PWM_SYNC_OUTPUT channels are committed here, one sync update per FTM.
+            Without batched channels this function has no effect.
+
+@return     void
+@retval     
+
+@pre None
+@post None
+*/
+/*=====================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_FlushOutputs(void)
+{
+    if (IODAL_INIT == IoDal_ModuleState)
+    {
+#if (IODAL_MAX_DIO_DESCRIPTORS > 0U) && (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+        IoDal_Dio_FlushOutputs();
+#endif
+#if (IODAL_MAX_PWM_DESCRIPTORS > 0U) && (IODAL_PWM_SYNC == STD_ON)
+        IoDal_Pwm_FlushOutputs();
+#endif
+    }
+    else
+    {
+        /*call Det: module not initialized*/
+#if (IODAL_DEV_ERROR_DETECT == STD_ON)        
+        Det_ReportError((uint16)IODAL_MODULE_ID, (uint8)0U, IODAL_FLUSHOUTPUTS_API_ID, IODAL_E_UNINIT);
+#endif    
+    }    
+}
+
 /*=====================================================================================================================*/
 /*=====================================================================================================================*/
 #ifdef __cplusplus
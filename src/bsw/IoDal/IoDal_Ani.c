@@ -48,6 +48,9 @@ extern "C"{
 #ifdef IFRW_DEBUG_PIN		
 #include "Dio.h"
 #endif
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+#include "SysDal_Defer.h"
+#endif
 /*====================================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
 =====================================================================================================================*/
@@ -123,6 +126,26 @@ extern "C"{
  #endif 
 #endif
 
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+ #if ((ADC_HW_TRIGGER_API != STD_ON) || (ADC_GRP_NOTIF_CAPABILITY != STD_ON))
+ #error "IODAL_ANI_HW_TRIGGER requires ADC_HW_TRIGGER_API and ADC_GRP_NOTIF_CAPABILITY"
+ #endif
+ #if (MCL_ENABLE_TRGMUX != STD_ON)
+ #error "IODAL_ANI_HW_TRIGGER requires MCL_ENABLE_TRGMUX"
+ #endif
+#endif
+
+#if (IODAL_ANI_HISTORY == STD_ON)
+ #if ((IODAL_ANI_HISTORY_SIZE & (IODAL_ANI_HISTORY_SIZE - 1U)) != 0U) || (IODAL_ANI_HISTORY_SIZE == 0U)
+ #error "IODAL_ANI_HISTORY_SIZE shall be a power of two"
+ #endif
+ #if (OCU_GET_COUNTER_API != STD_ON)
+ #error "IODAL_ANI_HISTORY requires OCU_GET_COUNTER_API for the sample timestamps"
+ #endif
+
+#define IODAL_ANI_HISTORY_MASK      ((uint32)IODAL_ANI_HISTORY_SIZE - 1U)
+#endif
+
 
 typedef enum
 {
@@ -131,6 +154,48 @@ typedef enum
     ADC_INVALID_STATE               /**< @brief mark conversion as invalid for analog descriptor. */ 
 }IoDal_AnalogConvState;
 
+/**
+* @brief          Descriptors converted by one Adc group.
+* @details        The descriptors of the group are IoDal_AniGroupDescriptorList[FirstEntry] to 
+*                 IoDal_AniGroupDescriptorList[FirstEntry + DescriptorCount - 1], in ascending order.
+*/
+typedef struct
+{
+    Adc_GroupType              AdcGroupId;        /**< @brief Adc group id. */
+    IoDal_BswDescriptorIdType  FirstDescriptor;   /**< @brief Lowest descriptor id of the group, selects the time trigger table entry. */
+    IoDal_BswDescriptorIdType  FirstEntry;        /**< @brief First entry of the group in the descriptor list. */
+    IoDal_BswDescriptorIdType  DescriptorCount;   /**< @brief Number of descriptors of the group. */
+}IoDal_AniGroupRangeType;
+
+#if (IODAL_ANI_FILTER == STD_ON)
+/**
+* @brief          Run time state of the filter stage of one analog descriptor.
+* @details        Iir holds the IIR output with IirShift fractional bits, it stays positive because
+*                 Iir - (Iir >> IirShift) + x never underflows, so the whole stage is unsigned fixed point.
+*/
+typedef struct
+{
+    uint32   Sum;        /**< @brief Decimator integrator, sum of the conversions of the current output. */
+    uint32   Iir;        /**< @brief IIR state. */
+    uint16   Count;      /**< @brief Number of conversions in Sum. */
+    boolean  Valid;      /**< @brief At least one output sample was produced since init. */
+}IoDal_AniFilterStateType;
+#endif
+
+#if (IODAL_ANI_HISTORY == STD_ON)
+/**
+* @brief          Sample history ring of one analog descriptor.
+* @details        A single context writes the ring: the conversion interrupt, or the deferred read of the software
+*                 triggered groups with IODAL_ANI_DEFERRED_READ. Head is the free running number of samples
+*                 written and is updated after the sample is complete, readers compare it with their cursor.
+*/
+typedef struct
+{
+    IoDal_AnalogSampleType  Sample[IODAL_ANI_HISTORY_SIZE];   /**< @brief Samples, oldest overwritten first. */
+    volatile uint32         Head;                             /**< @brief Sequence number of the next sample. */
+}IoDal_AniHistoryType;
+#endif
+
 
 #if IODAL_MAX_ANI_DESCRIPTORS > 0U
 /*====================================================================================================================
@@ -154,10 +219,34 @@ static VAR(Adc_ValueGroupType, AUTOMATIC) IoDal_AdcResultDescriptorBuffer[IODAL_
 static VAR(Adc_ValueGroupType, AUTOMATIC) IoDal_AdcStatusDescriptorBuffer[IODAL_MAX_ANI_DESCRIPTORS];
 
 /**
-* @brief          Variable holds the index of the current ADC channel that is being in use.
+* @brief          Variable holds the index in IoDal_AniGroupRange of the ADC group that is being in use.
+*
+*/
+static VAR(IoDal_BswDescriptorIdType, AUTOMATIC) IoDal_CurrentGroupIndex = 0U;
+
+/**
+* @brief          Adc groups used by the analog descriptors, in order of their lowest descriptor id.
 *
 */
-static VAR(Adc_GroupType,          AUTOMATIC) IoDal_CurrentDescriptorIndex = 0;
+static VAR(IoDal_AniGroupRangeType, AUTOMATIC) IoDal_AniGroupRange[IODAL_MAX_ANI_DESCRIPTORS];
+
+/**
+* @brief          Number of valid entries in IoDal_AniGroupRange.
+*
+*/
+static VAR(IoDal_BswDescriptorIdType, AUTOMATIC) IoDal_AniGroupCount = 0U;
+
+/**
+* @brief          Descriptor ids sorted by group, see IoDal_AniGroupRangeType.
+*
+*/
+static VAR(IoDal_BswDescriptorIdType, AUTOMATIC) IoDal_AniGroupDescriptorList[IODAL_MAX_ANI_DESCRIPTORS];
+
+/**
+* @brief          Channel position in the Adc group of each entry of IoDal_AniGroupDescriptorList.
+*
+*/
+static VAR(Adc_ChannelType, AUTOMATIC) IoDal_AniGroupChannelList[IODAL_MAX_ANI_DESCRIPTORS];
 
 /**
 * @brief          Variable holds the index of the Ocu trigger channel used in current configuration.
@@ -172,11 +261,62 @@ static VAR(Ocu_ChannelType, AUTOMATIC) IoDal_SwTriggerChannel = 0U;
 
 static VAR(IoDal_AnalogConvState, AUTOMATIC) IoDal_AniLogicalState = ADC_START_STATE;
 
+#if (IODAL_ANI_FILTER == STD_ON)
+/**
+* @brief          Filter stage state for each analog descriptor, the output is IoDal_AdcResultDescriptorBuffer.
+*
+*/
+static VAR(IoDal_AniFilterStateType, AUTOMATIC) IoDal_AniFilterState[IODAL_MAX_ANI_DESCRIPTORS];
+#endif
+
+#if (IODAL_ANI_HISTORY == STD_ON)
+/**
+* @brief          Sample history for each analog descriptor.
+*
+*/
+static VAR(IoDal_AniHistoryType, AUTOMATIC) IoDal_AniHistory[IODAL_MAX_ANI_DESCRIPTORS];
+#endif
+
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+/**
+* @brief          TRUE from the post of the deferred read of a group until it has run, at most one job per group.
+*
+*/
+static volatile VAR(boolean, AUTOMATIC) IoDal_AniGroupPending[IODAL_MAX_ANI_DESCRIPTORS];
+
+/**
+* @brief          Conversion status and time of the group conversion reported by its pending deferred read.
+*
+*/
+static VAR(Adc_ValueGroupType, AUTOMATIC) IoDal_AniGroupState[IODAL_MAX_ANI_DESCRIPTORS];
+static VAR(uint32, AUTOMATIC) IoDal_AniGroupTimestamp[IODAL_MAX_ANI_DESCRIPTORS];
+#endif
+
 /**
 * @brief          Variable holds the pointer to the Time Trigger table used for all descriptors in current configuration.
 *
 */
 P2VAR(Ocu_ValueType, AUTOMATIC, IODAL_APPL_DATA)  IoDal_pTimeTableEventsList = NULL_PTR; 
+
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+/**
+* @brief          Number of complete hardware triggered scans, incremented by the Adc group notification.
+*
+*/
+static volatile VAR(uint32, AUTOMATIC) IoDal_AniHwScanCount = 0U;
+
+/**
+* @brief          Scan count seen by the last supervision pass of IoDal_Ani_AdcHwTriggerHandler.
+*
+*/
+static VAR(uint32, AUTOMATIC) IoDal_AniHwScanCountChecked = 0U;
+
+/**
+* @brief          Number of consecutive supervision passes without a complete scan.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_AniHwScanMissed = 0U;
+#endif
 /*====================================================================================================================
                                          GLOBAL CONSTANTS
 =====================================================================================================================*/
@@ -189,11 +329,31 @@ P2VAR(Ocu_ValueType, AUTOMATIC, IODAL_APPL_DATA)  IoDal_pTimeTableEventsList = N
 /*====================================================================================================================
                                         LOCAL FUNCTION PROTOTYPES
 =====================================================================================================================*/
-static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcStartState(VAR(Adc_GroupType, AUTOMATIC) CurrentGroupId);
+static FUNC(IoDal_BswDescriptorIdType, IODAL_APP_CODE) IoDal_Ani_FindGroupRange(VAR(Adc_GroupType, AUTOMATIC) AdcGroupId);
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_BuildGroupRanges(void);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetGroupStatus(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcStartState(void);
 static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcReadState(void);
-static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_WriteChannelValueBuffers(VAR(Adc_GroupType, AUTOMATIC) AdcGroupId);
+#if (IODAL_ANI_FILTER == STD_ON)
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetFilter(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_FilterSample(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId, VAR(Adc_ValueGroupType, AUTOMATIC) Sample);
+#endif
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_WriteChannelValueBuffers(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex);
+#if (IODAL_ANI_HISTORY == STD_ON)
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_RecordSample(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId, VAR(uint32, AUTOMATIC) Timestamp, VAR(Adc_ValueGroupType, AUTOMATIC) Value, VAR(Adc_ValueGroupType, AUTOMATIC) State);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_RecordGroupHistory(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State, VAR(uint32, AUTOMATIC) Timestamp);
+#endif
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_CompleteGroup(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State, VAR(uint32, AUTOMATIC) Timestamp);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ReportGroup(VAR(Adc_ValueGroupType, AUTOMATIC) State);
 static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextUsableDescriptor(VAR(Adc_ValueGroupType, AUTOMATIC) State);
 static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetAdcStartState(void);
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeferredRead(uint32 WorkArg);
+#endif
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetHwScanStatus(VAR(Adc_ValueGroupType, AUTOMATIC) State);
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_StartHwTrigger(void);
+#endif
 /*====================================================================================================================
                                              LOCAL FUNCTIONS
 =====================================================================================================================*/
@@ -201,60 +361,307 @@ static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetAdcStartState(void);
                     
 /*===================================================================================================================*/
 /**
-@brief      IoDal_Ani_WriteChannelValueBuffers - Write the result buffers for all channels belonging to a certain group 
-@details    An Ani descriptor is a unique combination of Adc Group and channel and because coversion is done at group 
-            level we might have the situation where multiple descriptor channels have valid results stored in the ADC 
-			buffers, results that need to be copied to application buffer.
+@brief      IoDal_Ani_FindGroupRange - Looks up the group range of an Adc group
+@details    Only used while building the group ranges, the trigger table works on range indexes.
 
 @param[in]  AdcGroupId    Adc group id.
 
-@return     void
-@retval     
+@return     IoDal_BswDescriptorIdType   Index of the group in IoDal_AniGroupRange, IoDal_AniGroupCount if the
+                                        group has no range yet.
+@retval
 
 @pre None
 @post None
 */
-/*===================================================================================================================*/                        
-static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_WriteChannelValueBuffers(Adc_GroupType AdcGroupId)
+/*===================================================================================================================*/
+static FUNC(IoDal_BswDescriptorIdType, IODAL_APP_CODE) IoDal_Ani_FindGroupRange(VAR(Adc_GroupType, AUTOMATIC) AdcGroupId)
+{
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex = 0U;
+
+    while ((GroupIndex < IoDal_AniGroupCount) && (AdcGroupId != IoDal_AniGroupRange[GroupIndex].AdcGroupId))
+    {
+        GroupIndex++;
+    }
+    return GroupIndex;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_BuildGroupRanges - Builds the per group descriptor table
+@details    An Ani descriptor is a unique combination of Adc Group and channel and because conversion is done at
+            group level every step of the time trigger table has to handle all descriptors of one group.
+            The groups are ordered by their lowest descriptor id, which is the order the time trigger table
+            converts them in, and the descriptors of every group are listed contiguously together with their
+            channel position so the interrupt handlers only touch the descriptors of the group being serviced.
+
+@return     void
+@retval
+
+@pre        IoDal_pAniGlobalCfgPtr is set
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_BuildGroupRanges(void)
 {
     VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId = 0U;
-    VAR(Adc_ChannelType, AUTOMATIC) ChannelIndex = 0U;
-    VAR(Adc_GroupType, AUTOMATIC) CurrentGroupId = 0U;
-    P2VAR(Adc_ValueGroupType, AUTOMATIC, IODAL_APPL_CONST) AdcResultBufferPointer;
-    
-    
-    /*go through all descriptors */
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex = 0U;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) Entry = 0U;
+    P2CONST(IoDal_AnalogDescriptorType, AUTOMATIC, IODAL_APPL_CONST) pDescriptor;
+
+    IoDal_AniGroupCount = 0U;
+
+    /*one range per group, counting its descriptors*/
     for(AniDescriptorId = 0U; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
     {
-        CurrentGroupId = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId]).AdcGroupId;
-        
-        /*check if the group ids for the next descriptors are the same with the one from the global indexing descriptor*/        
-        if (CurrentGroupId == AdcGroupId)
+        pDescriptor = &((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId];
+        GroupIndex = IoDal_Ani_FindGroupRange(pDescriptor->AdcGroupId);
+
+        if (GroupIndex == IoDal_AniGroupCount)
         {
-            /*IoDal_AdcResultDescriptorBuffer[IoDal_CurrentDescriptorIndex] = AdcResultBufferPointer[AdcChannelIndex];*/
-            AdcResultBufferPointer = ((((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId]).pAdConvResultsPtr);
-           
-            /*get AD channel ID associate to this descriptor*/
-            ChannelIndex = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId]).AdcChannelId;
-            
-            /*all mark descriptors having the same group ans IDLE*/
-            IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = AdcResultBufferPointer[ChannelIndex];
+            IoDal_AniGroupRange[GroupIndex].AdcGroupId = pDescriptor->AdcGroupId;
+            IoDal_AniGroupRange[GroupIndex].FirstDescriptor = AniDescriptorId;
+            IoDal_AniGroupRange[GroupIndex].DescriptorCount = 0U;
+            IoDal_AniGroupCount++;
+        }
+        IoDal_AniGroupRange[GroupIndex].DescriptorCount++;
+    }
+
+    /*place the groups one after the other in the descriptor list*/
+    for(GroupIndex = 0U; GroupIndex < IoDal_AniGroupCount; GroupIndex++)
+    {
+        IoDal_AniGroupRange[GroupIndex].FirstEntry = Entry;
+        Entry += IoDal_AniGroupRange[GroupIndex].DescriptorCount;
+        IoDal_AniGroupRange[GroupIndex].DescriptorCount = 0U;
+    }
+
+    /*fill the list, the count is rebuilt as insertion index*/
+    for(AniDescriptorId = 0U; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
+    {
+        pDescriptor = &((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId];
+        GroupIndex = IoDal_Ani_FindGroupRange(pDescriptor->AdcGroupId);
+
+        Entry = IoDal_AniGroupRange[GroupIndex].FirstEntry + IoDal_AniGroupRange[GroupIndex].DescriptorCount;
+        IoDal_AniGroupDescriptorList[Entry] = AniDescriptorId;
+        IoDal_AniGroupChannelList[Entry] = pDescriptor->AdcChannelId;
+        IoDal_AniGroupRange[GroupIndex].DescriptorCount++;
+    }
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_SetGroupStatus - Sets the conversion status of all descriptors belonging to a group
+
+@param[in]  GroupIndex    Index of the group in IoDal_AniGroupRange.
+@param[in]  State         Conversion status.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetGroupStatus(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State)
+{
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) Entry = IoDal_AniGroupRange[GroupIndex].FirstEntry;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) LastEntry = Entry + IoDal_AniGroupRange[GroupIndex].DescriptorCount;
+
+    for(; Entry < LastEntry; Entry++)
+    {
+        IoDal_AdcStatusDescriptorBuffer[IoDal_AniGroupDescriptorList[Entry]] = State;
+    }
+}
+
+#if (IODAL_ANI_FILTER == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_ResetFilter - Restarts the filter stage of an analog descriptor
+
+@param[in]  AniDescriptorId    Analog descriptor id.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetFilter(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId)
+{
+    IoDal_AniFilterState[AniDescriptorId].Sum = 0U;
+    IoDal_AniFilterState[AniDescriptorId].Iir = 0U;
+    IoDal_AniFilterState[AniDescriptorId].Count = 0U;
+    IoDal_AniFilterState[AniDescriptorId].Valid = FALSE;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_FilterSample - Feeds one conversion result to the filter stage of an analog descriptor
+@details    The conversions are accumulated until 2^OversampleShift of them were summed, then the sum is scaled
+            to ExtraBits more than the Adc resolution, optionally smoothed by the IIR and written to the
+            descriptor result buffer. Between two outputs the cost is one addition and one compare, the output
+            step only uses shifts, so the stage fits in the conversion interrupt.
+
+@param[in]  AniDescriptorId    Analog descriptor id.
+@param[in]  Sample             Conversion result.
+
+@return     void
+@retval
+
+@pre        OversampleShift - ExtraBits >= 0 and the output fits in Adc_ValueGroupType
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_FilterSample(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId, VAR(Adc_ValueGroupType, AUTOMATIC) Sample)
+{
+    P2CONST(IoDal_AnalogFilterType, AUTOMATIC, IODAL_APPL_CONST) pFilter = &((IoDal_pAniGlobalCfgPtr->pAniFilter))[AniDescriptorId];
+    P2VAR(IoDal_AniFilterStateType, AUTOMATIC, IODAL_APPL_DATA) pState = &IoDal_AniFilterState[AniDescriptorId];
+    VAR(uint32, AUTOMATIC) Output;
+
+    pState->Sum += (uint32)Sample;
+    pState->Count++;
+
+    if (pState->Count >= ((uint16)1U << pFilter->OversampleShift))
+    {
+        /*decimate: 2^OversampleShift samples, keep ExtraBits of the sum*/
+        Output = pState->Sum >> (pFilter->OversampleShift - pFilter->ExtraBits);
+        pState->Sum = 0U;
+        pState->Count = 0U;
+
+        if (0U != pFilter->IirShift)
+        {
+            if (FALSE == pState->Valid)
+            {
+                /*start from the first output instead of ramping up from zero*/
+                pState->Iir = Output << pFilter->IirShift;
+            }
+            else
+            {
+                pState->Iir = (pState->Iir - (pState->Iir >> pFilter->IirShift)) + Output;
+            }
+            Output = pState->Iir >> pFilter->IirShift;
         }
+
+        IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = (Adc_ValueGroupType)Output;
+        pState->Valid = TRUE;
+    }
+}
+#endif
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_WriteChannelValueBuffers - Write the result buffers for all channels belonging to a certain group
+@details    An Ani descriptor is a unique combination of Adc Group and channel and because coversion is done at group
+            level we might have the situation where multiple descriptor channels have valid results stored in the ADC
+			buffers, results that need to be copied to application buffer.
+
+@param[in]  GroupIndex    Index of the group in IoDal_AniGroupRange.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_WriteChannelValueBuffers(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex)
+{
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId = 0U;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) Entry = IoDal_AniGroupRange[GroupIndex].FirstEntry;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) LastEntry = Entry + IoDal_AniGroupRange[GroupIndex].DescriptorCount;
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, IODAL_APPL_CONST) AdcResultBufferPointer;
+
+    /*all descriptors of a group share the group result buffer*/
+    AdcResultBufferPointer = ((((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_AniGroupRange[GroupIndex].FirstDescriptor]).pAdConvResultsPtr);
+
+    for(; Entry < LastEntry; Entry++)
+    {
+        AniDescriptorId = IoDal_AniGroupDescriptorList[Entry];
+#if (IODAL_ANI_FILTER == STD_ON)
+        IoDal_Ani_FilterSample(AniDescriptorId, AdcResultBufferPointer[IoDal_AniGroupChannelList[Entry]]);
+#else
+        IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = AdcResultBufferPointer[IoDal_AniGroupChannelList[Entry]];
+#endif
     }
 }
 
+#if (IODAL_ANI_HISTORY == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_RecordSample - Appends one conversion to the history of an analog descriptor
+@details    Shall only be called from the single writer of the history, see IoDal_AniHistoryType.
+
+@param[in]  AniDescriptorId    Analog descriptor id.
+@param[in]  Timestamp          Time of the conversion.
+@param[in]  Value              Conversion result.
+@param[in]  State              Conversion status.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_RecordSample(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId, VAR(uint32, AUTOMATIC) Timestamp, VAR(Adc_ValueGroupType, AUTOMATIC) Value, VAR(Adc_ValueGroupType, AUTOMATIC) State)
+{
+    P2VAR(IoDal_AniHistoryType, AUTOMATIC, IODAL_APPL_DATA) pHistory = &IoDal_AniHistory[AniDescriptorId];
+    VAR(uint32, AUTOMATIC) Head = pHistory->Head;
+
+    pHistory->Sample[Head & IODAL_ANI_HISTORY_MASK].Timestamp = Timestamp;
+    pHistory->Sample[Head & IODAL_ANI_HISTORY_MASK].Value = (IoDal_BswValueType)Value;
+    pHistory->Sample[Head & IODAL_ANI_HISTORY_MASK].Status = (uint8)State;
+
+    /*publish the sample only after it is completely written*/
+    pHistory->Head = Head + 1U;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_RecordGroupHistory - Appends the outcome of a group conversion to the history of its descriptors
+@details    Called by IoDal_Ani_CompleteGroup when the group is completed or skipped. The result is taken 
+            from the Adc group result buffer, which is not touched until the next start of the group.
+            Failed conversions are stored with value 0 so readers see every slot of the trigger table.
+
+@param[in]  GroupIndex    Index of the group in IoDal_AniGroupRange.
+@param[in]  State         Conversion status.
+@param[in]  Timestamp     Ocu counter value when the conversion was completed or skipped.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_RecordGroupHistory(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State, VAR(uint32, AUTOMATIC) Timestamp)
+{
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) Entry = IoDal_AniGroupRange[GroupIndex].FirstEntry;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) LastEntry = Entry + IoDal_AniGroupRange[GroupIndex].DescriptorCount;
+    VAR(Adc_ValueGroupType, AUTOMATIC) Value = 0U;
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, IODAL_APPL_CONST) AdcResultBufferPointer;
+
+    AdcResultBufferPointer = ((((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_AniGroupRange[GroupIndex].FirstDescriptor]).pAdConvResultsPtr);
+
+    for(; Entry < LastEntry; Entry++)
+    {
+        if (IODAL_AD_CONV_NO_ERROR == State)
+        {
+            Value = AdcResultBufferPointer[IoDal_AniGroupChannelList[Entry]];
+        }
+        IoDal_Ani_RecordSample(IoDal_AniGroupDescriptorList[Entry], Timestamp, Value, State);
+    }
+}
+#endif
 
 /*===================================================================================================================*/
 /**
 @brief      IoDal_Ani_SetNextAdcReadState - Sets the event for reading the Adc result on the current Adc group.
-@details    Adc uses group conversion and because it is possible to have different Ani descriptors using the same group 
-            (but with different channels from that group), we need to make sure that any measurement that we do is done once for each GROUP.
-            Basically we have to skip treating descriptors that have the same group once measurement was executed for that group.
-            
-            Due to the fact that conversion is done at group level it means that only one TT entry is needed for a group and one estimated conversion time.  This means that setting the next compare match event (that we either trigger a Start Conversion or a read result event ) has to be done once for each descriptor that contains an unique group ID. Descriptors that contain the 'other' channels in the group shall only be considerer when passing result from Adc internal buffer to IoDal read buffers.
+@details    Due to the fact that conversion is done at group level it means that only one TT entry is needed for a
+            group and one estimated conversion time, taken from the lowest descriptor of the group.
 
 @return     void
-@retval     
+@retval
 
 @pre None
 @post None
@@ -263,100 +670,65 @@ static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_WriteChannelValueBuffers(Adc_
 static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcReadState(void)
 {
     VAR(Ocu_ValueType, AUTOMATIC)  NextEventTime = 0U;
-   
+
    /*set next compare match by adding the conversion time for all channels (belonging to the given group) to the current time value */
-    NextEventTime = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_CurrentDescriptorIndex]).EstimatedConvTime;    
-        
+    NextEventTime = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_AniGroupRange[IoDal_CurrentGroupIndex].FirstDescriptor]).EstimatedConvTime;
+
    /*set next compare match as a relative value to the current Ocu counter value*/
    (void)Ocu_SetRelativeThreshold(IoDal_SwTriggerChannel, NextEventTime);
 
-   IoDal_AniLogicalState = ADC_READ_STATE;    
+   IoDal_AniLogicalState = ADC_READ_STATE;
 }
 
 /*===================================================================================================================*/
 /**
-@brief      IoDal_Ani_SetNextAdcStartState - Sets the next Ani descriptor to be used when starting the next 
+@brief      IoDal_Ani_SetNextAdcStartState - Sets the next Adc group to be used when starting the next
             measurements
 @details    This function shall be used to setup the next start conversion event on next ADC group in the list.
             When last group in list was reached this function shall set the first group as the next to be converted.
-            Adc uses group conversion and, because it is possible to have different Ani descriptors using 
-            the same group (but with different channels from that group), we need to make sure that any 
-			measurement that we do is done once for each GROUP.
-            Basically we have to skip treating descriptors that have the same group once measurement was executed 
-			for that group.
-            
-            Due to the fact that conversion is done at group level it means that only one TT entry is needed for a 
-			group and one estimated conversion time.  This means that setting the next compare match event (that we 
-			either trigger a Start Conversion or a read result event ) has to be done once for each descriptor that
-			contains an unique group ID. 
-			Descriptors that contain the 'other' channels in the group shall only be considerer when passing result
-			from Adc internal buffer to IoDal read buffers.
-
-@param[in]  CurrentGroupId    Adc group id.			
-			
+            The converted group shall already be reported by IoDal_Ani_ReportGroup. The start event of a group is
+            the time trigger table entry of its lowest descriptor.
+
 @return     void
-@retval     
+@retval
 
 @pre None
 @post None
 */
 /*===================================================================================================================*/
-static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcStartState(VAR(Adc_GroupType, AUTOMATIC) CurrentGroupId)
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcStartState(void)
 {
-    VAR(Adc_GroupType, AUTOMATIC) NextGroupId = 0U;
-    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId = 0U;
-    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) CommonGroupDescrId = 0U;
     VAR(Ocu_ValueType, AUTOMATIC)  NextEventTime = 0U;
     VAR(Ocu_ValueType, AUTOMATIC)  PrevEventTime = 0U;
-    
-    PrevEventTime = IoDal_pTimeTableEventsList[IoDal_CurrentDescriptorIndex];
 
-    /*get group ID from current Descriptor*/
-    for(AniDescriptorId = IoDal_CurrentDescriptorIndex; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
-    {
-        NextGroupId = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId]).AdcGroupId;
-            
-        /*check if the group ids for the next descriptors are the same with the one from the global indexing descriptor*/        
-        if (CurrentGroupId == NextGroupId)
-        {
-            /*all mark descriptors having the same group ans IDLE*/
-            IoDal_AdcStatusDescriptorBuffer[AniDescriptorId] = IODAL_AD_CONV_NO_ERROR; 
-                
-            /*increment no of descriptors using same group id*/
-            CommonGroupDescrId++;
-        }            
-    }
-    
-    /*add descriptors with same group to the current index (these descriptors need to be skipped)*/
-    IoDal_CurrentDescriptorIndex = IoDal_CurrentDescriptorIndex + (CommonGroupDescrId - 1U);
-    
+    PrevEventTime = IoDal_pTimeTableEventsList[IoDal_AniGroupRange[IoDal_CurrentGroupIndex].FirstDescriptor];
+
     /*increment current index*/
-    IoDal_CurrentDescriptorIndex++;
-        
-    if (IoDal_CurrentDescriptorIndex >= (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount))
+    IoDal_CurrentGroupIndex++;
+
+    if (IoDal_CurrentGroupIndex >= IoDal_AniGroupCount)
     {
-        IoDal_CurrentDescriptorIndex = 0;            
+        IoDal_CurrentGroupIndex = 0U;
     }
-        
-    IoDal_AniLogicalState = ADC_START_STATE;  
-    
-    NextEventTime = IoDal_pTimeTableEventsList[IoDal_CurrentDescriptorIndex];
-    
+
+    IoDal_AniLogicalState = ADC_START_STATE;
+
+    NextEventTime = IoDal_pTimeTableEventsList[IoDal_AniGroupRange[IoDal_CurrentGroupIndex].FirstDescriptor];
+
     (void)Ocu_SetAbsoluteThreshold(IoDal_SwTriggerChannel, PrevEventTime, NextEventTime);
-    
+
 }
 
 /*===================================================================================================================*/
 /**
-@brief      IoDal_Ani_SetNextUsableDescriptor - Sets the next Ani descriptor to be used for measurements
-@details    This function is called when ever errors are detected, in order to skip the current group measurement and
-            start measurements on the next group which has a valid timer stamp attached to it.
+@brief      IoDal_Ani_SetNextUsableDescriptor - Marks the descriptors of the current group after a conversion error
+@details    This function is called when ever errors are detected, in order to skip the current group measurement.
 			All channels beloging to the group that had conversion error shall be marked with the same error information.
 
-@param[in]  State    Adc group id.				
-			
+@param[in]  State    Conversion status.
+
 @return     void
-@retval     
+@retval
 
 @pre None
 @post None
@@ -364,40 +736,143 @@ static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextAdcStartState(VAR(Adc_
 /*===================================================================================================================*/
 static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextUsableDescriptor(VAR(Adc_ValueGroupType, AUTOMATIC) State)
 {
-    VAR(Adc_GroupType, AUTOMATIC) NextGroupId = 0U;
-    VAR(Adc_GroupType, AUTOMATIC) CurrentGroupId = 0U;
-    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId = 0U;
-    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) CommonGroupDescrId = 0U;
+    /*all mark descriptors having the same group with the error state*/
+    IoDal_Ani_ReportGroup(State);
+}
 
-    /*TODO: this function should be made reentrant by protecting global data*/
-    CurrentGroupId = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_CurrentDescriptorIndex]).AdcGroupId;
-        
-    /*get group ID from current Descriptor*/
-    for(AniDescriptorId = IoDal_CurrentDescriptorIndex; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_ResetAdcStartState - Sets the first compare match event used for triggering measurements on the current group
+@details    This internal function shall be called to reset the HW unit logical state and restart measurement when ever an error was detected
+            or when the first ever measurement is queued.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetAdcStartState(void)
+{
+    VAR(Ocu_ValueType, AUTOMATIC)  NextEventTime = 0U;
+
+    NextEventTime = (Ocu_ValueType)IoDal_pTimeTableEventsList[IoDal_AniGroupRange[IoDal_CurrentGroupIndex].FirstDescriptor];
+
+     /*set absolute value for the first compare match event */
+    (void)Ocu_SetAbsoluteThreshold(IoDal_SwTriggerChannel, 0, NextEventTime);
+
+    IoDal_AniLogicalState = ADC_START_STATE;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_CompleteGroup - Publishes the outcome of a group conversion to its descriptors
+@details    Copies the results of a completed conversion, then sets the status of all descriptors of the group
+            and appends the outcome to their history. With IODAL_ANI_DEFERRED_READ only called in task context by
+            IoDal_Ani_DeferredRead, otherwise in the trigger table interrupt.
+
+@param[in]  GroupIndex    Index of the group in IoDal_AniGroupRange.
+@param[in]  State         Conversion status.
+@param[in]  Timestamp     Ocu counter value when the conversion was completed or skipped.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_CompleteGroup(VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex, VAR(Adc_ValueGroupType, AUTOMATIC) State, VAR(uint32, AUTOMATIC) Timestamp)
+{
+    if (IODAL_AD_CONV_NO_ERROR == State)
     {
-        NextGroupId = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId]).AdcGroupId;
-            
-        /*check if the group ids for the next descriptors are the same with the one from the global indexing descriptor*/        
-        if (CurrentGroupId == NextGroupId)
+        IoDal_Ani_WriteChannelValueBuffers(GroupIndex);
+    }
+    IoDal_Ani_SetGroupStatus(GroupIndex, State);
+#if (IODAL_ANI_HISTORY == STD_ON)
+    IoDal_Ani_RecordGroupHistory(GroupIndex, State, Timestamp);
+#else
+    (void)Timestamp;
+#endif
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_ReportGroup - Reports the outcome of the current group from the trigger table interrupt
+@details    With IODAL_ANI_DEFERRED_READ the outcome is handed to IoDal_Ani_DeferredRead, at most one job is queued 
+            per group: a conversion reported while the job of its group is still queued is dropped. When the
+            queue is full the conversion is dropped too and the descriptors of the group are flagged
+            IODAL_AD_CONV_INVALID, no result is copied in interrupt context. Without IODAL_ANI_DEFERRED_READ the
+            outcome is published at once.
+
+@param[in]  State         Conversion status.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ReportGroup(VAR(Adc_ValueGroupType, AUTOMATIC) State)
+{
+    VAR(uint32, AUTOMATIC) Timestamp = (uint32)Ocu_GetCounter(IoDal_SwTriggerChannel);
+
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+    if (FALSE == IoDal_AniGroupPending[IoDal_CurrentGroupIndex])
+    {
+        /*state and time are only written while no job of the group is queued, the job reads them undisturbed*/
+        IoDal_AniGroupState[IoDal_CurrentGroupIndex] = State;
+        IoDal_AniGroupTimestamp[IoDal_CurrentGroupIndex] = Timestamp;
+        IoDal_AniGroupPending[IoDal_CurrentGroupIndex] = TRUE;
+
+        if ((Std_ReturnType)E_OK != SysDal_Defer_Post(SYSDAL_DEFER_QUEUE_IODAL_ANI, &IoDal_Ani_DeferredRead, (uint32)IoDal_CurrentGroupIndex))
         {
-            /*all mark descriptors having the same group as IODAL_AD_CONV_INVALID*/
-            IoDal_AdcStatusDescriptorBuffer[AniDescriptorId] = State; 
-                
-            /*increment no of descriptors using same group id*/
-            CommonGroupDescrId++;
-        }            
+            /*queue full - the conversion is dropped and flagged*/
+            IoDal_AniGroupPending[IoDal_CurrentGroupIndex] = FALSE;
+            IoDal_Ani_SetGroupStatus(IoDal_CurrentGroupIndex, IODAL_AD_CONV_INVALID);
+        }
     }
-    
-    /*IoDal_CurrentDescriptorIndex = IoDal_CurrentDescriptorIndex + (CommonGroupDescrId -1U);*/ 
+#else
+    IoDal_Ani_CompleteGroup(IoDal_CurrentGroupIndex, State, Timestamp);
+#endif
 }
 
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_DeferredRead - Publish the outcome of a group conversion in task context
+@details    Posted by IoDal_Ani_ReportGroup on the SysDal deferred work queue. The ADC result buffer
+            of the group is stable until the next start of the same group, which only happens after all the
+            other groups of the time trigger table were converted. The group may be reported again once
+            the job has run.
+
+@param[in]  WorkArg    Index of the Adc group in IoDal_AniGroupRange.
 
+@return     void
+@retval     
 
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeferredRead(uint32 WorkArg)
+{
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) GroupIndex = (IoDal_BswDescriptorIdType)WorkArg;
+
+    IoDal_Ani_CompleteGroup(GroupIndex, IoDal_AniGroupState[GroupIndex], IoDal_AniGroupTimestamp[GroupIndex]);
+
+    IoDal_AniGroupPending[GroupIndex] = FALSE;
+}
+#endif
+
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
 /*===================================================================================================================*/
 /**
-@brief      IoDal_Ani_ResetAdcStartState - Sets the first compare match event used for triggering measurements on the first descriptor
-@details    This internal function shall be called to reset the HW unit logical state and restart measurement when ever an error was detected
-            or when the first ever measurement is queued.
+@brief      IoDal_Ani_SetHwScanStatus - Sets the status of all descriptors converted by the hardware triggered scan
+
+@param[in]  State    Conversion status.
 
 @return     void
 @retval     
@@ -406,20 +881,48 @@ static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetNextUsableDescriptor(VAR(A
 @post None
 */
 /*===================================================================================================================*/
-static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_ResetAdcStartState(void)
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_SetHwScanStatus(VAR(Adc_ValueGroupType, AUTOMATIC) State)
 {
-    VAR(Ocu_ValueType, AUTOMATIC)  NextEventTime = 0U;         
-    
-    NextEventTime = (Ocu_ValueType)IoDal_pTimeTableEventsList[IoDal_CurrentDescriptorIndex]; 
-        
-     /*set absolute value for the first compare match event */
-    (void)Ocu_SetAbsoluteThreshold(IoDal_SwTriggerChannel, 0, NextEventTime);
-        
-    IoDal_AniLogicalState = ADC_START_STATE;    
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId = 0U;
+
+    for(AniDescriptorId = 0U; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
+    {
+        IoDal_AdcStatusDescriptorBuffer[AniDescriptorId] = State;
+    }
 }
 
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_StartHwTrigger - Starts the hardware triggered scan of all analog descriptors
+@details    Routes the configured trigger source through TRGMUX to the PDB of the scan group, enables the
+            hardware trigger of the group and starts the Gpt channel timing the scan. From then on the PDB 
+            pre-triggers chain the group channels back-to-back into the group result buffer set up by 
+            pfAdcBufferSetupCallout, so the CPU only sees the group notification once per scan.
+
+@return     void
+@retval     
+
+@pre        Mcl_Init was called with the TRGMUX configuration
+@post None
+*/
+/*===================================================================================================================*/
+static inline FUNC(void, IODAL_APP_CODE) IoDal_Ani_StartHwTrigger(void)
+{
+    P2CONST(IoDal_AnalogHwTriggerType, AUTOMATIC, IODAL_APPL_CONST) pHwTrigger = IoDal_pAniGlobalCfgPtr->pAdcHwTrigger;
+
+    IoDal_AniHwScanCount = 0U;
+    IoDal_AniHwScanCountChecked = 0U;
+    IoDal_AniHwScanMissed = 0U;
 
+    Mcl_TrgMuxConfigInput(pHwTrigger->TrgMuxRegister, pHwTrigger->TrgMuxSelect, pHwTrigger->TrgMuxSource);
 
+    Adc_EnableGroupNotification(pHwTrigger->AdcGroupId);
+
+    Adc_EnableHardwareTrigger(pHwTrigger->AdcGroupId);
+
+    Gpt_StartTimer(pHwTrigger->GptChannel, pHwTrigger->GptPeriod);
+}
+#endif
 
 /*====================================================================================================================
                                              GLOBAL FUNCTIONS
@@ -452,7 +955,7 @@ FUNC (void, IODAL_APP_CODE) IoDal_Ani_AdcSwTriggerTable(void)
         
     if(NULL_PTR != IoDal_pAniGlobalCfgPtr)
     {
-        AdcGroupIndex    = (((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[IoDal_CurrentDescriptorIndex]).AdcGroupId;
+        AdcGroupIndex    = IoDal_AniGroupRange[IoDal_CurrentGroupIndex].AdcGroupId;
                 
         switch(IoDal_AniLogicalState)
         {
@@ -479,17 +982,15 @@ FUNC (void, IODAL_APP_CODE) IoDal_Ani_AdcSwTriggerTable(void)
 
             case ADC_READ_STATE:
             {
-                /* pass data from external Adc buffer to Ani descriptor data array*/
-                IoDal_Ani_WriteChannelValueBuffers(AdcGroupIndex);
-                    
                 Adc_StopGroupConversion(AdcGroupIndex);
 			#ifdef IFRW_DEBUG_PIN			
                 Dio_WriteChannel(DioConf_DioChannel_DioChannel_0, 0);
 			#endif	
                 if (ADC_IDLE == Adc_GetGroupStatus(AdcGroupIndex))
                 {            
-                     /*mark conversion as completed and move to next descriptor*/                
-                    IoDal_Ani_SetNextAdcStartState(AdcGroupIndex);
+                     /*pass data from external Adc buffer to Ani descriptor data array, mark conversion as completed and move to next descriptor*/                
+                    IoDal_Ani_ReportGroup(IODAL_AD_CONV_NO_ERROR);
+                    IoDal_Ani_SetNextAdcStartState();
                 }
                 else
                 {
@@ -548,20 +1049,36 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
             IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = 0U;
             
             IoDal_AdcStatusDescriptorBuffer[AniDescriptorId] = IODAL_AD_CONV_INIT;         
+#if (IODAL_ANI_FILTER == STD_ON)
+            IoDal_Ani_ResetFilter(AniDescriptorId);
+#endif
+#if (IODAL_ANI_HISTORY == STD_ON)
+            IoDal_AniHistory[AniDescriptorId].Head = 0U;
+#endif
+#if (IODAL_ANI_DEFERRED_READ == STD_ON)
+            IoDal_AniGroupPending[AniDescriptorId] = FALSE;
+#endif
         }
         
+        IoDal_Ani_BuildGroupRanges();
+
         IoDal_pAniGlobalCfgPtr->pfAdcBufferSetupCallout();
 
-        /*Start SW trigger channel if trigger channel was not started before*/
+        /*the counter of the trigger channel timestamps the history in both trigger modes, it runs from Ocu_Init on*/
         TriggerDescrId = ConfigPtr->AdcSwTriggerDescriptorIndex;
             
         IoDal_SwTriggerChannel = (((IoDal_pAniGlobalCfgPtr->pOcuChanDescriptor))[TriggerDescrId]).OcuChannel;
+
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+        IoDal_Ani_StartHwTrigger();
+#else
+        /*Start SW trigger channel if trigger channel was not started before*/
             
         /*get time trigger table */
         IoDal_pTimeTableEventsList = (Ocu_ValueType *)((((IoDal_pAniGlobalCfgPtr->pOcuChanDescriptor))[IoDal_SwTriggerChannel]).pTimeTableEventsList);
 
             
-        IoDal_CurrentDescriptorIndex = 0;   
+        IoDal_CurrentGroupIndex = 0U;   
             
         IoDal_Ani_ResetAdcStartState();    
         
@@ -571,6 +1088,7 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
         Ocu_StartChannel(IoDal_SwTriggerChannel);
                     
         Ocu_EnableNotification(IoDal_SwTriggerChannel);
+#endif
     }    
 }
 
@@ -597,14 +1115,28 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeInit(void)
             /*de-initialize all used data*/    
             IoDal_AdcStatusDescriptorBuffer[AniDescriptorId] = IODAL_AD_CONV_INIT;
             IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = 0U;
+#if (IODAL_ANI_FILTER == STD_ON)
+            IoDal_Ani_ResetFilter(AniDescriptorId);
+#endif
         }   
               
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+        /*stop the hardware triggered scan and disconnect its trigger source*/
+        Gpt_StopTimer(IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->GptChannel);
+
+        Adc_DisableHardwareTrigger(IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->AdcGroupId);
+
+        Adc_DisableGroupNotification(IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->AdcGroupId);
+
+        Mcl_TrgMuxConfigInput(IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->TrgMuxRegister, IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->TrgMuxSelect, MCL_TRGMUX_INPUT_DISABLED);
+#else
         /*stop trigger channels if the trigger channel was not previously stopped*/
         Ocu_DisableNotification(IoDal_SwTriggerChannel);
         
         Ocu_StopChannel(IoDal_SwTriggerChannel);  
+#endif
         
-        IoDal_CurrentDescriptorIndex = 0;        
+        IoDal_CurrentGroupIndex = 0U;        
             
         IoDal_AniLogicalState = ADC_START_STATE;       
      
@@ -617,7 +1149,9 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeInit(void)
 /*===================================================================================================================*/
 /**
 @brief      IoDal_Ani_AdcHwTriggerHandler - Adc Hw Trigger handler for IODAL
-@details    
+@details    Supervision of the hardware triggered scan, called once per IoDal_MainFunction period.
+            The results are valid while at least one complete scan was notified during the last
+            IODAL_ANI_HW_SCAN_TIMEOUT periods, otherwise all analog descriptors are marked as invalid.
 
 @return     void
 @retval     
@@ -628,7 +1162,86 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_DeInit(void)
 /*===================================================================================================================*/
 FUNC(void, IODAL_APP_CODE) IoDal_Ani_AdcHwTriggerHandler(void)
 {
-    /*TODO: Add support for HW trigger handling*/
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+    VAR(uint32, AUTOMATIC) ScanCount;
+
+    if(NULL_PTR != IoDal_pAniGlobalCfgPtr)
+    {
+        ScanCount = IoDal_AniHwScanCount;
+
+        if (ScanCount != IoDal_AniHwScanCountChecked)
+        {
+            IoDal_AniHwScanCountChecked = ScanCount;
+            IoDal_AniHwScanMissed = 0U;
+            IoDal_Ani_SetHwScanStatus(IODAL_AD_CONV_NO_ERROR);
+        }
+        else if (IoDal_AniHwScanMissed < IODAL_ANI_HW_SCAN_TIMEOUT)
+        {
+            IoDal_AniHwScanMissed++;
+        }
+        else
+        {
+            /*trigger source or Adc group stopped - results are stale*/
+            IoDal_Ani_SetHwScanStatus(IODAL_AD_CONV_INVALID);
+        }
+    }
+#endif
+}
+
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_AdcHwScanNotification - Adc group notification of the hardware triggered scan
+@details    Called once per complete scan, after the results of all channels of the group were written.
+            Copies the results out of the group result buffer - into the descriptor filters with the filter
+            stage, into the IoDal result buffer otherwise - before the buffer is released for the next 
+            trigger, so IoDal_Ani_ReadInputs never reads a buffer the next scan is writing.
+            Referenced by the Adc configuration of AdcAniScanGroup, empty without IODAL_ANI_HW_TRIGGER.
+
+@return     void
+@retval     
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_Ani_AdcHwScanNotification(void)
+{
+#if (IODAL_ANI_HW_TRIGGER == STD_ON)
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, IODAL_APPL_DATA) pLastResult;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId;
+    P2CONST(IoDal_AnalogDescriptorType, AUTOMATIC, IODAL_APPL_CONST) pDescriptor;
+    VAR(Adc_ValueGroupType, AUTOMATIC) Sample;
+#if (IODAL_ANI_HISTORY == STD_ON)
+    VAR(uint32, AUTOMATIC) Timestamp;
+#endif
+
+    if(NULL_PTR != IoDal_pAniGlobalCfgPtr)
+    {
+#if (IODAL_ANI_HISTORY == STD_ON)
+        /*same time base as the software trigger table, all channels of the scan share one timestamp*/
+        Timestamp = (uint32)Ocu_GetCounter(IoDal_SwTriggerChannel);
+#endif
+        for(AniDescriptorId = 0U; AniDescriptorId < (IoDal_pAniGlobalCfgPtr->AdcDescriptorsCount); AniDescriptorId++)
+        {
+            pDescriptor = &((IoDal_pAniGlobalCfgPtr->pAnGroupDescriptor))[AniDescriptorId];
+            Sample = pDescriptor->pAdConvResultsPtr[pDescriptor->AdcChannelId];
+#if (IODAL_ANI_FILTER == STD_ON)
+            IoDal_Ani_FilterSample(AniDescriptorId, Sample);
+#else
+            IoDal_AdcResultDescriptorBuffer[AniDescriptorId] = Sample;
+#endif
+#if (IODAL_ANI_HISTORY == STD_ON)
+            IoDal_Ani_RecordSample(AniDescriptorId, Timestamp, Sample, IODAL_AD_CONV_NO_ERROR);
+#endif
+        }
+
+        /*group status goes back from ADC_STREAM_COMPLETED to ADC_BUSY*/
+        (void)Adc_GetStreamLastPointer(IoDal_pAniGlobalCfgPtr->pAdcHwTrigger->AdcGroupId, &pLastResult);
+
+        IoDal_AniHwScanCount++;
+    }
+#endif
 }
 
 
@@ -638,6 +1251,8 @@ FUNC(void, IODAL_APP_CODE) IoDal_Ani_AdcHwTriggerHandler(void)
 @brief      IoDal_Ani_ReadInputs - Read the Processed Adc Inputs
 @details    Provides ADC output information as both value and status for the layers above IODAL.
             Each BswIoChannel is described by an unique descriptor ID (a unique combination of Adc group and channel )
+            With IODAL_ANI_FILTER the value is the filter stage output, E_NOT_OK is returned until the first
+            output sample of the descriptor was produced.
 
 @param[in]  BswIoChannel    Logical BSW input channel id.
 @param[out] InputValue      Value read from the assigned adc input channel.			
@@ -663,12 +1278,94 @@ FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Ani_ReadInputs(IoDal_BswChannelIdType
     
         if (IODAL_AD_CONV_NO_ERROR == IoDal_AdcStatusDescriptorBuffer[AniDescriptorId])
         {
+#if (IODAL_ANI_FILTER == STD_ON)
+            if (TRUE == IoDal_AniFilterState[AniDescriptorId].Valid)
+            {
+                RetVal = E_OK;
+            }
+#else
             RetVal = E_OK;
+#endif
         }
     }
 
     return RetVal;    
 }
+
+#if (IODAL_ANI_HISTORY == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Ani_ReadHistory - Read all samples of an analog input since a cursor
+@details    Copies the samples from *Cursor on, oldest first, straight from the history ring into the caller 
+            buffer and advances the cursor past the last copied sample. A reader that fell more than 
+            IODAL_ANI_HISTORY_SIZE samples behind continues with the oldest sample still stored. Samples that
+            the conversion interrupt overwrote while they were being copied are returned with status
+            IODAL_AD_CONV_INVALID instead of being copied a second time.
+
+@param[in]     BswIoChannel    Logical BSW input channel id.
+@param[in,out] Cursor          Sequence number of the next sample to read, 0 after init.
+@param[out]    Samples         Caller buffer for the samples.
+@param[in,out] SampleCount     In: size of Samples, out: number of samples written to Samples.
+
+@return     Std_ReturnType
+@retval     E_OK            All samples since the cursor were returned or are still pending.
+@retval     E_NOT_OK        Samples were lost, or the module is not initialized.
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Ani_ReadHistory(IoDal_BswChannelIdType BswIoChannel, IoDal_AnalogHistoryCursorType * Cursor, IoDal_AnalogSampleType * Samples, uint16 * SampleCount)
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+    VAR(IoDal_BswDescriptorIdType, AUTOMATIC) AniDescriptorId;
+    P2VAR(IoDal_AniHistoryType, AUTOMATIC, IODAL_APPL_DATA) pHistory;
+    VAR(uint32, AUTOMATIC) Head;
+    VAR(uint32, AUTOMATIC) Next;
+    VAR(uint32, AUTOMATIC) Count;
+    VAR(uint32, AUTOMATIC) Index;
+
+    if(NULL_PTR != IoDal_pAniGlobalCfgPtr)
+    {
+        AniDescriptorId = ((IoDal_pAniGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+        pHistory = &IoDal_AniHistory[AniDescriptorId];
+        Head = pHistory->Head;
+        Next = *Cursor;
+        RetVal = E_OK;
+
+        if ((Head - Next) > (uint32)IODAL_ANI_HISTORY_SIZE)
+        {
+            /*the reader fell behind (or the cursor is from before a re-init), skip the overwritten samples*/
+            Next = (Head > (uint32)IODAL_ANI_HISTORY_SIZE) ? (Head - (uint32)IODAL_ANI_HISTORY_SIZE) : 0U;
+            RetVal = E_NOT_OK;
+        }
+
+        Count = Head - Next;
+        if (Count > (uint32)*SampleCount)
+        {
+            Count = (uint32)*SampleCount;
+        }
+
+        for(Index = 0U; Index < Count; Index++)
+        {
+            Samples[Index] = pHistory->Sample[(Next + Index) & IODAL_ANI_HISTORY_MASK];
+        }
+
+        /*samples older than Head - IODAL_ANI_HISTORY_SIZE may have been overwritten during the copy*/
+        Head = pHistory->Head;
+        for(Index = 0U; (Index < Count) && ((Head - (Next + Index)) > (uint32)IODAL_ANI_HISTORY_SIZE); Index++)
+        {
+            Samples[Index].Status = (uint8)IODAL_AD_CONV_INVALID;
+            RetVal = E_NOT_OK;
+        }
+
+        *Cursor = Next + Count;
+        *SampleCount = (uint16)Count;
+    }
+
+    return RetVal;
+}
+#endif
 #endif
 
 /*======================================================================================================================*/
@@ -47,6 +47,9 @@ extern "C"{
 #include "IoDal_Cfg.h"
 #include "IoDal_Dio.h"
 #include "Dio.h"
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+#include "SysDal.h"
+#endif
 
 /*===================================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -126,6 +129,48 @@ extern "C"{
 ====================================================================================================================*/
 
 
+/*===================================================================================================================
+                                        LOCAL MACROS
+====================================================================================================================*/
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON) || (IODAL_DIO_OUTPUT_BATCH == STD_ON) || (IODAL_DIO_INPUT_EVENT == STD_ON)
+/* Dio channel ids encode the port in the upper bits and the pin in the lower 5 bits (32 pins per port) */
+#define IODAL_DIO_PORT_SHIFT                ((uint8)5U)
+#define IODAL_DIO_PIN_MASK                  ((Dio_ChannelType)0x1FU)
+#endif
+
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON) && (DIO_MASKEDWRITEPORT_API != STD_ON)
+    #error "IODAL_DIO_OUTPUT_BATCH requires DIO_MASKEDWRITEPORT_API"
+#endif
+
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+/* PORT pin interrupt registers, PORTA to PORTE are 0x1000 apart */
+#define IODAL_DIO_PORT_COUNT                ((uint8)5U)
+#define IODAL_DIO_PORT_BASE_ADDR32(Port)    ((uint32)0x40049000UL + ((uint32)(Port) << 12U))
+#define IODAL_DIO_PORT_PCR_ADDR32(Port, Pin) (IODAL_DIO_PORT_BASE_ADDR32(Port) + ((uint32)(Pin) << 2U))
+#define IODAL_DIO_PORT_ISFR_ADDR32(Port)    (IODAL_DIO_PORT_BASE_ADDR32(Port) + (uint32)0xA0UL)
+#define IODAL_DIO_PORT_PCR_IRQC_MASK_U32    ((uint32)0x000F0000UL)
+#define IODAL_DIO_PORT_PCR_IRQC_EITHER_U32  ((uint32)0x000B0000UL)
+/* interrupt status flag, write one to clear */
+#define IODAL_DIO_PORT_PCR_ISF_U32          ((uint32)0x01000000UL)
+#endif
+
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+#ifndef IFWK_USE_ICU
+    #error "Input capture channels require IFWK_USE_ICU"
+#endif
+#if (ICU_TIMESTAMP_API != STD_ON) || (ICU_GET_INPUT_LEVEL_API != STD_ON)
+    #error "Input capture channels require ICU_TIMESTAMP_API and ICU_GET_INPUT_LEVEL_API"
+#endif
+/* edge timestamps needed for one measurement: one period, or one period and the edge splitting it */
+#define IODAL_ICU_PERIOD_EDGES              ((uint8)2U)
+#define IODAL_ICU_DUTY_EDGES                ((uint8)3U)
+/* 100% duty cycle, same scale as the Pwm duty cycle */
+#define IODAL_ICU_DUTY_SHIFT                ((uint8)15U)
+#define IODAL_ICU_DUTY_100                  ((IoDal_BswDutyType)0x8000U)
+/* level reads retried when an edge is captured while the level is sampled */
+#define IODAL_ICU_LEVEL_RETRIES             ((uint8)2U)
+#endif
+
 /*===================================================================================================================
                           LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ====================================================================================================================*/
@@ -171,6 +216,125 @@ static VAR(boolean,       AUTOMATIC) IoDal_DioResyncRequest[IODAL_MAX_DIO_DESCRI
 */
 static VAR(uint32,        AUTOMATIC) IoDal_DigitalOutputLevel[IODAL_MAX_DIO_DESCRIPTORS];
 
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+/**
+* @brief          Ports holding at least one IODAL_DIO_INPUT channel, in order of first use.
+*
+*/
+static VAR(Dio_PortType, AUTOMATIC) IoDal_DioSnapshotPort[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Port levels read by the last IoDal_Dio_SampleInputs, one entry per IoDal_DioSnapshotPort.
+*
+*/
+static VAR(Dio_PortLevelType, AUTOMATIC) IoDal_DioSnapshotLevel[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Number of valid entries in IoDal_DioSnapshotPort.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_DioSnapshotPortCount = 0U;
+
+/**
+* @brief          Index in IoDal_DioSnapshotPort of the port of each digital input descriptor.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_DioSnapshotSlot[IODAL_MAX_DIO_DESCRIPTORS];
+#endif
+
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+/**
+* @brief          Ports holding at least one IODAL_DIO_OUTPUT channel, in order of first use.
+*
+*/
+static VAR(Dio_PortType, AUTOMATIC) IoDal_DioBatchPort[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Output levels requested during the current cycle, one entry per IoDal_DioBatchPort.
+*
+*/
+static VAR(Dio_PortLevelType, AUTOMATIC) IoDal_DioBatchLevel[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Pins written during the current cycle (dirty mask), one entry per IoDal_DioBatchPort.
+*
+*/
+static VAR(Dio_PortLevelType, AUTOMATIC) IoDal_DioBatchMask[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Number of valid entries in IoDal_DioBatchPort.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_DioBatchPortCount = 0U;
+
+/**
+* @brief          Index in IoDal_DioBatchPort of the port of each digital output descriptor.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_DioBatchSlot[IODAL_MAX_DIO_DESCRIPTORS];
+#endif
+
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+/**
+* @brief          Pins with an edge event input, per port.
+*
+*/
+static VAR(uint32, AUTOMATIC) IoDal_DioEventPinMask[IODAL_DIO_PORT_COUNT];
+
+/**
+* @brief          Digital descriptors of the edge event inputs.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_DioEventDescriptor[IODAL_MAX_DIO_DESCRIPTORS];
+static VAR(uint8, AUTOMATIC) IoDal_DioEventCount = 0U;
+
+/**
+* @brief          Edge latched by the PORT interrupt and not read yet, per digital descriptor.
+*
+*/
+static volatile VAR(boolean, AUTOMATIC) IoDal_DioEdgePending[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Core cycle count of the newest edge, per digital descriptor.
+*
+*/
+static volatile VAR(uint32, AUTOMATIC) IoDal_DioEdgeTime[IODAL_MAX_DIO_DESCRIPTORS];
+
+/**
+* @brief          Pin level read after the newest reported edge, per digital descriptor.
+*
+*/
+static VAR(IoDal_BswValueType, AUTOMATIC) IoDal_DioEventLevel[IODAL_MAX_DIO_DESCRIPTORS];
+#endif
+
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+/**
+* @brief          Timestamp circular buffer of each input capture descriptor.
+* @details        Written by the Icu driver (DMA) on every edge, only read by IoDal.
+*
+*/
+static VAR(Icu_ValueType, AUTOMATIC) IoDal_IcuTimestampBuffer[IODAL_MAX_ICU_DESCRIPTORS][IODAL_ICU_TIMESTAMP_BUFFER_SIZE];
+
+/**
+* @brief          Timestamp index and newest timestamp seen by the last read, to detect new edges.
+*
+*/
+static VAR(Icu_IndexType, AUTOMATIC) IoDal_IcuLastIndex[IODAL_MAX_ICU_DESCRIPTORS];
+static VAR(Icu_ValueType, AUTOMATIC) IoDal_IcuLastTimestamp[IODAL_MAX_ICU_DESCRIPTORS];
+
+/**
+* @brief          Edges captured since start, saturated at IODAL_ICU_DUTY_EDGES.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_IcuEdgeCount[IODAL_MAX_ICU_DESCRIPTORS];
+
+/**
+* @brief          Consecutive reads without a new edge, saturated at IdleReadLimit.
+*
+*/
+static VAR(uint8, AUTOMATIC) IoDal_IcuIdleReads[IODAL_MAX_ICU_DESCRIPTORS];
+#endif
+
 
 /*===================================================================================================================
                                        GLOBAL CONSTANTS
@@ -185,11 +349,184 @@ static VAR(uint32,        AUTOMATIC) IoDal_DigitalOutputLevel[IODAL_MAX_DIO_DESC
 /*===================================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ====================================================================================================================*/
-
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+static FUNC(void, IODAL_APP_CODE) IoDal_Dio_EdgeIsr(VAR(Dio_PortType, AUTOMATIC) Port);
+#endif
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON) || (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+static FUNC(uint8, IODAL_APP_CODE) IoDal_Dio_GetPortSlot(VAR(uint8, AUTOMATIC) DioDescriptorIndex, P2VAR(Dio_PortType, AUTOMATIC, IODAL_APPL_DATA) pPortList, P2VAR(uint8, AUTOMATIC, IODAL_APPL_DATA) pPortCount);
+#endif
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+static FUNC(uint32, IODAL_APP_CODE) IoDal_Dio_IcuElapsed(VAR(uint32, AUTOMATIC) TimerRange, VAR(Icu_ValueType, AUTOMATIC) Older, VAR(Icu_ValueType, AUTOMATIC) Newer);
+static FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_IcuGetIndexAndLevel(VAR(Icu_ChannelType, AUTOMATIC) IcuChannel, P2VAR(Icu_IndexType, AUTOMATIC, IODAL_APPL_DATA) pIndex, P2VAR(Icu_LevelType, AUTOMATIC, IODAL_APPL_DATA) pLevel);
+#endif
 
 /*===================================================================================================================
                                        LOCAL FUNCTIONS
 ====================================================================================================================*/
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON) || (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_GetPortSlot - Looks up the port of a digital descriptor in a port list
+@details    The port is appended to the list when it is used for the first time. Shared by the input snapshot
+            and the output batch, each with its own list.
+
+@param[in]     DioDescriptorIndex    Digital descriptor id.
+@param[in,out] pPortList             Port list.
+@param[in,out] pPortCount            Number of valid entries in pPortList.
+
+@return     uint8   Index of the port in pPortList.
+@retval     
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(uint8, IODAL_APP_CODE) IoDal_Dio_GetPortSlot(VAR(uint8, AUTOMATIC) DioDescriptorIndex, P2VAR(Dio_PortType, AUTOMATIC, IODAL_APPL_DATA) pPortList, P2VAR(uint8, AUTOMATIC, IODAL_APPL_DATA) pPortCount)
+{
+    VAR(Dio_PortType, AUTOMATIC) Port;
+    VAR(uint8, AUTOMATIC)        Slot = 0U;
+
+    Port = (Dio_PortType)((((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex]).DioChannel >> IODAL_DIO_PORT_SHIFT);
+
+    while ((Slot < *pPortCount) && (Port != pPortList[Slot]))
+    {
+        Slot++;
+    }
+
+    if (Slot == *pPortCount)
+    {
+        pPortList[Slot] = Port;
+        (*pPortCount)++;
+    }
+
+    return Slot;
+}
+#endif
+
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_EdgeIsr - Latches the edges of the event inputs of a port
+@details    Only timestamps the edge and marks it pending, the debounce is left to the reader. A bouncing
+            contact costs one short interrupt per bounce and no processing in the cyclic tasks.
+            With IODAL_DIO_EDGE_WAKEUP the edge is also the wakeup event of the SysDal sleep mode.
+
+@param[in]  Port    Dio port of the PORT instance that raised the interrupt.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(void, IODAL_APP_CODE) IoDal_Dio_EdgeIsr(VAR(Dio_PortType, AUTOMATIC) Port)
+{
+    VAR(uint32, AUTOMATIC) Flags;
+    VAR(uint32, AUTOMATIC) Now;
+    VAR(uint8, AUTOMATIC)  Entry;
+    VAR(Dio_ChannelType, AUTOMATIC) ChannelId;
+
+    Now = SysDal_GetCycleCount();
+    Flags = REG_READ32(IODAL_DIO_PORT_ISFR_ADDR32(Port)) & IoDal_DioEventPinMask[Port];
+    REG_WRITE32(IODAL_DIO_PORT_ISFR_ADDR32(Port), Flags);
+
+    for (Entry = 0U; Entry < IoDal_DioEventCount; Entry++)
+    {
+        ChannelId = (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[IoDal_DioEventDescriptor[Entry]]).DioChannel;
+
+        if ((Port == (Dio_PortType)(ChannelId >> IODAL_DIO_PORT_SHIFT)) && (0U != (Flags & ((uint32)1U << (ChannelId & IODAL_DIO_PIN_MASK)))))
+        {
+            IoDal_DioEdgeTime[IoDal_DioEventDescriptor[Entry]] = Now;
+            IoDal_DioEdgePending[IoDal_DioEventDescriptor[Entry]] = TRUE;
+        }
+    }
+#if (IODAL_DIO_EDGE_WAKEUP == STD_ON)
+    if (0U != Flags)
+    {
+        WakeUpNotification();
+    }
+#endif
+}
+#endif
+
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_IcuElapsed - Timer ticks between two timestamps of the same channel
+@details    The timestamps are counter values, the counter wraps after TimerRange ticks. The two edges shall be
+            less than TimerRange ticks apart.
+
+@param[in]  TimerRange    Ticks of one counter period.
+@param[in]  Older         Timestamp of the first edge.
+@param[in]  Newer         Timestamp of the second edge.
+
+@return     uint32   Ticks from Older to Newer.
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(uint32, IODAL_APP_CODE) IoDal_Dio_IcuElapsed(VAR(uint32, AUTOMATIC) TimerRange, VAR(Icu_ValueType, AUTOMATIC) Older, VAR(Icu_ValueType, AUTOMATIC) Newer)
+{
+    VAR(uint32, AUTOMATIC) Elapsed;
+
+    if (Newer >= Older)
+    {
+        Elapsed = (uint32)Newer - (uint32)Older;
+    }
+    else
+    {
+        Elapsed = (TimerRange - (uint32)Older) + (uint32)Newer;
+    }
+    return Elapsed;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_IcuGetIndexAndLevel - Reads the timestamp index together with the input level
+@details    The level is the polarity of the newest edge only if no edge was captured while it was sampled,
+            the index is read before and after the level and the read is retried when it moved.
+
+@param[in]  IcuChannel    Icu channel id.
+@param[out] pIndex        Index of the next timestamp to be written in the circular buffer.
+@param[out] pLevel        Input level after the newest edge.
+
+@return     Std_ReturnType
+@retval     E_OK          Index and level are consistent.
+@retval     E_NOT_OK      The input toggled during every retry.
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+static FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_IcuGetIndexAndLevel(VAR(Icu_ChannelType, AUTOMATIC) IcuChannel, P2VAR(Icu_IndexType, AUTOMATIC, IODAL_APPL_DATA) pIndex, P2VAR(Icu_LevelType, AUTOMATIC, IODAL_APPL_DATA) pLevel)
+{
+    VAR(Icu_IndexType, AUTOMATIC)  Index;
+    VAR(uint8, AUTOMATIC)          Retry = 0U;
+    VAR(Std_ReturnType, AUTOMATIC) retVal = E_NOT_OK;
+
+    Index = Icu_GetTimestampIndex(IcuChannel);
+
+    while ((E_OK != retVal) && (Retry <= IODAL_ICU_LEVEL_RETRIES))
+    {
+        *pLevel = Icu_GetInputLevel(IcuChannel);
+        *pIndex = Icu_GetTimestampIndex(IcuChannel);
+
+        if (*pIndex == Index)
+        {
+            retVal = E_OK;
+        }
+        else
+        {
+            Index = *pIndex;
+            Retry++;
+        }
+    }
+    return retVal;
+}
+#endif
 
 
 /*===================================================================================================================
@@ -213,8 +550,15 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
     VAR(uint8, AUTOMATIC)                DioDescriptorIndex;    
     VAR(uint8, AUTOMATIC)                BswIoChannel;
     VAR(IoDal_BswChannelType, AUTOMATIC) ChannelType;
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+    VAR(uint8, AUTOMATIC)                IcuDescriptorIndex;
+#endif
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+    VAR(Dio_ChannelType, AUTOMATIC)      ChannelId;
+    VAR(Dio_PortType, AUTOMATIC)         Port;
+#endif
     uint8 MaxIoChannels;
-        
+
     
     IoDal_pDioGlobalCfgPtr = ConfigPtr;
     
@@ -230,6 +574,20 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
         IoDal_DigitalInputLevel[DioDescriptorIndex]  = STD_LOW;
         IoDal_DioResyncRequest[DioDescriptorIndex]   = FALSE; 
     }    
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+    IoDal_DioSnapshotPortCount = 0U;
+#endif
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+    IoDal_DioBatchPortCount = 0U;
+#endif
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+    SysDal_EnableCycleCounter();
+    for(Port = 0U; Port < IODAL_DIO_PORT_COUNT; Port++)
+    {
+        IoDal_DioEventPinMask[Port] = 0U;
+    }
+    IoDal_DioEventCount = 0U;
+#endif
         
     for (BswIoChannel = 0U;  BswIoChannel < MaxIoChannels; BswIoChannel++ )
     {    
@@ -238,6 +596,36 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
         switch (ChannelType)
         {    
             case IODAL_DIO_INPUT:
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+            {
+                DioDescriptorIndex    =  ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+
+                IoDal_DioSnapshotSlot[DioDescriptorIndex] = IoDal_Dio_GetPortSlot(DioDescriptorIndex, IoDal_DioSnapshotPort, &IoDal_DioSnapshotPortCount);
+            }
+#endif
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+            {
+                DioDescriptorIndex    =  ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+
+                if ((boolean)TRUE == (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex]).EdgeEvent)
+                {
+                    ChannelId = (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex]).DioChannel;
+                    Port = (Dio_PortType)(ChannelId >> IODAL_DIO_PORT_SHIFT);
+
+                    IoDal_DioEdgePending[DioDescriptorIndex] = FALSE;
+                    IoDal_DioEdgeTime[DioDescriptorIndex] = SysDal_GetCycleCount();
+                    IoDal_DioEventDescriptor[IoDal_DioEventCount] = DioDescriptorIndex;
+                    IoDal_DioEventCount++;
+                    IoDal_DioEventPinMask[Port] |= (uint32)1U << (ChannelId & IODAL_DIO_PIN_MASK);
+
+                    /*interrupt on both edges, a stale flag is cleared on the way*/
+                    REG_RMW32(IODAL_DIO_PORT_PCR_ADDR32(Port, ChannelId & IODAL_DIO_PIN_MASK),
+                              IODAL_DIO_PORT_PCR_IRQC_MASK_U32 | IODAL_DIO_PORT_PCR_ISF_U32,
+                              IODAL_DIO_PORT_PCR_IRQC_EITHER_U32 | IODAL_DIO_PORT_PCR_ISF_U32);
+                    IoDal_DioEventLevel[DioDescriptorIndex] = (IoDal_BswValueType)Dio_ReadChannel(ChannelId);
+                }
+            }
+#endif
             break;
             
             case IODAL_DIO_OUTPUT:
@@ -246,12 +634,33 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
                 
                 /*setup all configured channels to their default values*/
                 IoDal_DigitalOutputLevel[DioDescriptorIndex] = (Dio_LevelType)(((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor)[DioDescriptorIndex]).ChannelLevel);
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+                IoDal_DioBatchSlot[DioDescriptorIndex] = IoDal_Dio_GetPortSlot(DioDescriptorIndex, IoDal_DioBatchPort, &IoDal_DioBatchPortCount);
+                IoDal_DioBatchLevel[IoDal_DioBatchSlot[DioDescriptorIndex]] = 0U;
+                IoDal_DioBatchMask[IoDal_DioBatchSlot[DioDescriptorIndex]] = 0U;
+#endif
                 
-            }break;    
-            
+            }break;
+
             case IODAL_TIMER_CAPTURE:
-            break;            
-            
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+            {
+                IcuDescriptorIndex = ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+
+                IoDal_IcuLastIndex[IcuDescriptorIndex]     = 0U;
+                IoDal_IcuLastTimestamp[IcuDescriptorIndex] = 0U;
+                IoDal_IcuEdgeCount[IcuDescriptorIndex]     = 0U;
+                IoDal_IcuIdleReads[IcuDescriptorIndex]     = 0U;
+
+                /*edges are stored by the Icu driver from now on, nothing is done per edge by IoDal*/
+                Icu_StartTimestamp((((IoDal_pDioGlobalCfgPtr->pIcuChanDescriptor))[IcuDescriptorIndex]).InputCaptureChannel,
+                                   IoDal_IcuTimestampBuffer[IcuDescriptorIndex],
+                                   (uint16)IODAL_ICU_TIMESTAMP_BUFFER_SIZE,
+                                   (uint16)IODAL_ICU_TIMESTAMP_NOTIFY);
+            }
+#endif
+            break;
+
             case IODAL_TIMER_OUTPUT:
             break;
             
@@ -265,6 +674,11 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
             break;    
         }
     }    
+
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+    /*inputs are valid before the first cyclic snapshot*/
+    IoDal_Dio_SampleInputs();
+#endif
 }
 
 /*===================================================================================================================*/
@@ -281,6 +695,13 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
 FUNC(void, IODAL_APP_CODE) IoDal_Dio_DeInit(void)
 {
     VAR(uint8, AUTOMATIC)                DioDescriptorIndex;
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+    VAR(uint8, AUTOMATIC)                Entry;
+    VAR(Dio_ChannelType, AUTOMATIC)      ChannelId;
+#endif
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+    VAR(uint8, AUTOMATIC)                IcuDescriptorIndex;
+#endif
     
     for(DioDescriptorIndex = 0U; DioDescriptorIndex < IODAL_MAX_DIO_DESCRIPTORS; DioDescriptorIndex++)
     {    
@@ -288,17 +709,77 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_DeInit(void)
         IoDal_DigitalInputLevel[DioDescriptorIndex]  = STD_LOW;
         IoDal_DioResyncRequest[DioDescriptorIndex]   = FALSE; 
     }
-    
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+    IoDal_DioSnapshotPortCount = 0U;
+#endif
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+    IoDal_DioBatchPortCount = 0U;
+#endif
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        for(Entry = 0U; Entry < IoDal_DioEventCount; Entry++)
+        {
+            ChannelId = (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[IoDal_DioEventDescriptor[Entry]]).DioChannel;
+            REG_RMW32(IODAL_DIO_PORT_PCR_ADDR32(ChannelId >> IODAL_DIO_PORT_SHIFT, ChannelId & IODAL_DIO_PIN_MASK),
+                      IODAL_DIO_PORT_PCR_IRQC_MASK_U32 | IODAL_DIO_PORT_PCR_ISF_U32,
+                      IODAL_DIO_PORT_PCR_ISF_U32);
+        }
+    }
+    IoDal_DioEventCount = 0U;
+#endif
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        for(IcuDescriptorIndex = 0U; IcuDescriptorIndex < IoDal_pDioGlobalCfgPtr->IcuChannelCount; IcuDescriptorIndex++)
+        {
+            Icu_StopTimestamp((((IoDal_pDioGlobalCfgPtr->pIcuChanDescriptor))[IcuDescriptorIndex]).InputCaptureChannel);
+        }
+    }
+#endif
+
     IoDal_pDioGlobalCfgPtr = NULL_PTR;
 }
 
 
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_SampleInputs - Takes the snapshot of all digital inputs
+@details    Reads every port holding an IODAL_DIO_INPUT channel with one Dio_ReadPort, so all inputs of a 
+            cycle are sampled together and the cost is one port access per port instead of one driver call
+            per input read.
+
+@return     void
+@retval     
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_Dio_SampleInputs(void)
+{
+    VAR(uint8, AUTOMATIC) Slot;
+
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        for (Slot = 0U; Slot < IoDal_DioSnapshotPortCount; Slot++)
+        {
+            IoDal_DioSnapshotLevel[Slot] = Dio_ReadPort(IoDal_DioSnapshotPort[Slot]);
+        }
+    }
+}
+#endif
+
 /*===================================================================================================================*/
 /**
 @brief      IoDal_Dio_ReadDigitalInputs - Read the Processed Digital Inputs
 @details    For channels connected to DIO  this function shall call the driver directly.
+            With IODAL_DIO_INPUT_SNAPSHOT the level is taken from the last port snapshot instead.
             For external devices this function shall read the internal buffer associated to the BSW channel.
 			This buffer shall be cyclically updated by the IODAL main function which handles external devices.
+            For input capture channels the value is the signal period in timer ticks (saturated), see
+            IoDal_Dio_ReadCapture.
 
 @param[in]  BswIoChannel    Logical BSW input channel id.
 @param[out] InputValue      Value read from the assigned digital input channel.
@@ -317,26 +798,36 @@ FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadInputs(IoDal_BswChannelIdType
     VAR(Dio_LevelType, AUTOMATIC)       ChannelValue;
     VAR(IoDal_BswChannelType, AUTOMATIC) ChannelType;
     VAR(Std_ReturnType, AUTOMATIC)       retVal = E_NOT_OK;
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+    VAR(IoDal_CaptureValueType, AUTOMATIC) CaptureValue = {0U, 0U};
+#endif
 
     if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
-    {        
-        DioDescriptorIndex    =  ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;        
-        
-        ChannelId    = (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex]).DioChannel;
+    {
+        DioDescriptorIndex    =  ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
 
         ChannelType = ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswChannelType;
-                
+
         switch (ChannelType)
-        {    
+        {
             case IODAL_DIO_INPUT:
+                ChannelId    = (((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex]).DioChannel;
+#if (IODAL_DIO_INPUT_SNAPSHOT == STD_ON)
+                ChannelValue = (((IoDal_DioSnapshotLevel[IoDal_DioSnapshotSlot[DioDescriptorIndex]] >> (ChannelId & IODAL_DIO_PIN_MASK)) & 1U) != 0U) ? (Dio_LevelType)STD_HIGH : (Dio_LevelType)STD_LOW;
+#else
                 ChannelValue = Dio_ReadChannel((Dio_ChannelType)ChannelId);
+#endif
                 *InputValue = (IoDal_BswValueType)ChannelValue;
                 retVal = E_OK;
             break;
-                    
+
             case IODAL_TIMER_CAPTURE:
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+                retVal = IoDal_Dio_ReadCapture(BswIoChannel, &CaptureValue);
+                *InputValue = (CaptureValue.Period > 0xFFFFU) ? (IoDal_BswValueType)0xFFFFU : (IoDal_BswValueType)CaptureValue.Period;
+#endif
             break;
-                    
+
             case IODAL_EXT_DEV_INPUT:    
                 *InputValue  = IoDal_DigitalInputLevel[DioDescriptorIndex];
                 IoDal_DioResyncRequest[DioDescriptorIndex] = TRUE; 
@@ -349,15 +840,265 @@ FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadInputs(IoDal_BswChannelIdType
     else
     {
         /*do nothing*/
-    }    
-    
+    }
+
     return retVal;
 }
 
+#if (IODAL_MAX_ICU_DESCRIPTORS > 0U)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_ReadCapture - Computes period and duty cycle of an input capture channel
+@details    The edges are timestamped into the circular buffer of the channel by the Icu driver (DMA), without
+            any IoDal processing per edge. Period and duty cycle are only computed here, from the newest
+            timestamps: the two newest edges give the period of a single edge channel, the three newest edges
+            the period and high time of a both edges channel, the polarity of the newest edge being the current
+            input level. The buffer shall be large enough that it is not overwritten while being read.
+            Without a new edge during IdleReadLimit consecutive reads the input is reported as stopped, with a
+            period of 0 and the duty cycle of the current level.
+
+@param[in]  BswIoChannel    Logical BSW input capture channel id.
+@param[out] CaptureValue    Measured signal.
+
+@return     Std_ReturnType
+@retval     E_OK            CaptureValue is valid.
+@retval     E_NOT_OK        Not enough edges captured yet, or the input toggled during every level read.
+
+@pre        Called from a single task context
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadCapture(IoDal_BswChannelIdType BswIoChannel, P2VAR(IoDal_CaptureValueType, AUTOMATIC, IODAL_APPL_DATA) CaptureValue)
+{
+    VAR(uint8, AUTOMATIC)                IcuDescriptorIndex;
+    P2CONST(IoDal_IcuDescriptorType, AUTOMATIC, IODAL_APPL_CONST) pDescriptor;
+    P2CONST(Icu_ValueType, AUTOMATIC, IODAL_APPL_DATA) pBuffer;
+    VAR(Icu_IndexType, AUTOMATIC)        Index;
+    VAR(Icu_LevelType, AUTOMATIC)        Level;
+    VAR(uint32, AUTOMATIC)               Newest;
+    VAR(uint32, AUTOMATIC)               NewEdges;
+    VAR(uint32, AUTOMATIC)               LastSpan;
+    VAR(uint32, AUTOMATIC)               Period;
+    VAR(uint32, AUTOMATIC)               HighTime;
+    VAR(uint8, AUTOMATIC)                EdgesNeeded;
+    VAR(Std_ReturnType, AUTOMATIC)       retVal = E_NOT_OK;
+
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        IcuDescriptorIndex = ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+        pDescriptor = &((IoDal_pDioGlobalCfgPtr->pIcuChanDescriptor))[IcuDescriptorIndex];
+        pBuffer = IoDal_IcuTimestampBuffer[IcuDescriptorIndex];
+
+        if (E_OK == IoDal_Dio_IcuGetIndexAndLevel(pDescriptor->InputCaptureChannel, &Index, &Level))
+        {
+            Index = (Icu_IndexType)((uint32)Index % IODAL_ICU_TIMESTAMP_BUFFER_SIZE);
+            Newest = ((uint32)Index + IODAL_ICU_TIMESTAMP_BUFFER_SIZE - 1U) % IODAL_ICU_TIMESTAMP_BUFFER_SIZE;
+
+            /*new edges since the last read, a same index with a new timestamp is a complete buffer round*/
+            if ((Index != IoDal_IcuLastIndex[IcuDescriptorIndex]) || (pBuffer[Newest] != IoDal_IcuLastTimestamp[IcuDescriptorIndex]))
+            {
+                NewEdges = (((uint32)Index + IODAL_ICU_TIMESTAMP_BUFFER_SIZE) - (uint32)IoDal_IcuLastIndex[IcuDescriptorIndex]) % IODAL_ICU_TIMESTAMP_BUFFER_SIZE;
+                if ((0U == NewEdges) || ((NewEdges + IoDal_IcuEdgeCount[IcuDescriptorIndex]) > IODAL_ICU_DUTY_EDGES))
+                {
+                    IoDal_IcuEdgeCount[IcuDescriptorIndex] = IODAL_ICU_DUTY_EDGES;
+                }
+                else
+                {
+                    IoDal_IcuEdgeCount[IcuDescriptorIndex] += (uint8)NewEdges;
+                }
+                IoDal_IcuLastIndex[IcuDescriptorIndex] = Index;
+                IoDal_IcuLastTimestamp[IcuDescriptorIndex] = pBuffer[Newest];
+                IoDal_IcuIdleReads[IcuDescriptorIndex] = 0U;
+            }
+            else if (IoDal_IcuIdleReads[IcuDescriptorIndex] < pDescriptor->IdleReadLimit)
+            {
+                IoDal_IcuIdleReads[IcuDescriptorIndex]++;
+            }
+            else
+            {
+                /*do nothing*/
+            }
+
+            EdgesNeeded = ((boolean)TRUE == pDescriptor->MeasureDutyCycle) ? IODAL_ICU_DUTY_EDGES : IODAL_ICU_PERIOD_EDGES;
+
+            if (IoDal_IcuIdleReads[IcuDescriptorIndex] >= pDescriptor->IdleReadLimit)
+            {
+                /*input stuck at its current level*/
+                CaptureValue->Period = 0U;
+                CaptureValue->DutyCycle = (ICU_LEVEL_HIGH == Level) ? IODAL_ICU_DUTY_100 : (IoDal_BswDutyType)0U;
+                retVal = E_OK;
+            }
+            else if (IoDal_IcuEdgeCount[IcuDescriptorIndex] >= EdgesNeeded)
+            {
+                LastSpan = IoDal_Dio_IcuElapsed(pDescriptor->TimerRange,
+                                                pBuffer[(Newest + IODAL_ICU_TIMESTAMP_BUFFER_SIZE - 1U) % IODAL_ICU_TIMESTAMP_BUFFER_SIZE],
+                                                pBuffer[Newest]);
+
+                if ((boolean)TRUE == pDescriptor->MeasureDutyCycle)
+                {
+                    Period = LastSpan + IoDal_Dio_IcuElapsed(pDescriptor->TimerRange,
+                                                             pBuffer[(Newest + IODAL_ICU_TIMESTAMP_BUFFER_SIZE - 2U) % IODAL_ICU_TIMESTAMP_BUFFER_SIZE],
+                                                             pBuffer[(Newest + IODAL_ICU_TIMESTAMP_BUFFER_SIZE - 1U) % IODAL_ICU_TIMESTAMP_BUFFER_SIZE]);
+                    CaptureValue->Period = Period;
+
+                    /*the newest edge is rising if the input is high, the last span is then the low time*/
+                    HighTime = (ICU_LEVEL_HIGH == Level) ? (Period - LastSpan) : LastSpan;
+
+                    /*keep HighTime << IODAL_ICU_DUTY_SHIFT within 32 bits*/
+                    while (Period > 0xFFFFU)
+                    {
+                        Period >>= 1U;
+                        HighTime >>= 1U;
+                    }
+                    CaptureValue->DutyCycle = (0U != Period) ? (IoDal_BswDutyType)((HighTime << IODAL_ICU_DUTY_SHIFT) / Period) : (IoDal_BswDutyType)0U;
+                }
+                else
+                {
+                    CaptureValue->Period = LastSpan;
+                    CaptureValue->DutyCycle = 0U;
+                }
+                retVal = E_OK;
+            }
+            else
+            {
+                /*not enough edges since start*/
+            }
+        }
+    }
+
+    return retVal;
+}
+#endif
+
+#if (IODAL_DIO_INPUT_EVENT == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_ReadInputEvent - Reads and clears the latched edge of an event input
+@details    The pending edge is cleared before its timestamp is read, an edge latched in between is kept pending
+            and reported again by the next read with its own timestamp. EdgeAge is the time since the last
+            edge latched on the input, in core cycles, whether reported now or by an earlier read; a reader
+            debouncing the input accepts Level once EdgeAge exceeds the bounce time of the contact.
+            The pin is read only when an edge is reported: both edges interrupt, so without a pending edge
+            the pin still has the level read after the last one and the cached level is returned. An edge
+            between clearing and reading the pin stays pending and the pin is read again on the next call.
+
+@param[in]  BswIoChannel    Logical BSW input channel id.
+@param[out] InputEvent      Edge and level of the input.
+
+@return     Std_ReturnType
+@retval     E_OK            InputEvent is valid.
+@retval     E_NOT_OK        The channel is not configured with EdgeEvent.
+
+@pre        Called from a single task context
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(Std_ReturnType, IODAL_APP_CODE) IoDal_Dio_ReadInputEvent(IoDal_BswChannelIdType BswIoChannel, P2VAR(IoDal_InputEventType, AUTOMATIC, IODAL_APPL_DATA) InputEvent)
+{
+    VAR(uint8, AUTOMATIC)                DioDescriptorIndex;
+    VAR(Std_ReturnType, AUTOMATIC)       retVal = E_NOT_OK;
+    P2CONST(IoDal_DigitalDescriptorType, AUTOMATIC, IODAL_APPL_CONST) pDescriptor;
+
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        DioDescriptorIndex = ((IoDal_pDioGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
+        pDescriptor = &((IoDal_pDioGlobalCfgPtr->pDioChanDescriptor))[DioDescriptorIndex];
+
+        if ((boolean)TRUE == pDescriptor->EdgeEvent)
+        {
+            InputEvent->EdgeDetected = IoDal_DioEdgePending[DioDescriptorIndex];
+            if ((boolean)TRUE == InputEvent->EdgeDetected)
+            {
+                IoDal_DioEdgePending[DioDescriptorIndex] = FALSE;
+                IoDal_DioEventLevel[DioDescriptorIndex] = (IoDal_BswValueType)Dio_ReadChannel(pDescriptor->DioChannel);
+            }
+            InputEvent->EdgeAge = SysDal_GetCycleCount() - IoDal_DioEdgeTime[DioDescriptorIndex];
+            InputEvent->Level = IoDal_DioEventLevel[DioDescriptorIndex];
+            retVal = E_OK;
+        }
+    }
+
+    return retVal;
+}
+
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_PortX_EdgeIsr - PORT pin interrupt handlers of the event inputs
+@details    One handler per PORT instance, only the instances with event inputs have to be registered.
+
+@return     void
+@retval
+
+@pre None
+@post None
+*/
+/*===================================================================================================================*/
+ISR(IoDal_Dio_PortA_EdgeIsr)
+{
+    IoDal_Dio_EdgeIsr((Dio_PortType)0U);
+}
+
+ISR(IoDal_Dio_PortB_EdgeIsr)
+{
+    IoDal_Dio_EdgeIsr((Dio_PortType)1U);
+}
+
+ISR(IoDal_Dio_PortC_EdgeIsr)
+{
+    IoDal_Dio_EdgeIsr((Dio_PortType)2U);
+}
+
+ISR(IoDal_Dio_PortD_EdgeIsr)
+{
+    IoDal_Dio_EdgeIsr((Dio_PortType)3U);
+}
+
+ISR(IoDal_Dio_PortE_EdgeIsr)
+{
+    IoDal_Dio_EdgeIsr((Dio_PortType)4U);
+}
+#endif
+
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+/*===================================================================================================================*/
+/**
+@brief      IoDal_Dio_FlushOutputs - Writes the digital outputs requested during the cycle
+@details    Every port with at least one written IODAL_DIO_OUTPUT channel is updated with a single 
+            Dio_MaskedWritePort. On S32K14x that is one PSOR store for all rising edges of the port followed
+            by one PCOR store for all falling edges: edges of the same direction switch together, opposite 
+            edges are two back-to-back stores apart. PDOR is not written directly since a read-modify-write
+            would race with the other writers of the port. Pins not written in the cycle keep their level.
+
+@return     void
+@retval     
+
+@pre        Called from the task context issuing IoDal_Dio_WriteOutputs
+@post None
+*/
+/*===================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_Dio_FlushOutputs(void)
+{
+    VAR(uint8, AUTOMATIC) Slot;
+
+    if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
+    {
+        for (Slot = 0U; Slot < IoDal_DioBatchPortCount; Slot++)
+        {
+            if (0U != IoDal_DioBatchMask[Slot])
+            {
+                Dio_MaskedWritePort(IoDal_DioBatchPort[Slot], IoDal_DioBatchLevel[Slot], IoDal_DioBatchMask[Slot]);
+                IoDal_DioBatchMask[Slot] = 0U;
+            }
+        }
+    }
+}
+#endif
+
 /*===================================================================================================================*/
 /**
 @brief      IoDal_WriteDigitalOutputs - Write the output requests.
 @details    For channels connected to DIO  this function shall call the driver directly.
+            With IODAL_DIO_OUTPUT_BATCH the level is only recorded and written by the next IoDal_Dio_FlushOutputs.
             For external devices this function shall buffer the requested output value and 
 			the handling of the device shall be done on the next call of the Main function.
 
@@ -376,6 +1117,10 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_WriteOutputs(IoDal_BswChannelIdType BswIoCh
     VAR(uint8, AUTOMATIC)               DioDescriptorIndex;
     VAR(Dio_ChannelType, AUTOMATIC)     ChannelId;
     VAR(IoDal_BswChannelType, AUTOMATIC) ChannelType;
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+    VAR(uint8, AUTOMATIC)               Slot;
+    VAR(Dio_PortLevelType, AUTOMATIC)   PinMask;
+#endif
     
     if(NULL_PTR != IoDal_pDioGlobalCfgPtr)
     {
@@ -389,7 +1134,22 @@ FUNC(void, IODAL_APP_CODE) IoDal_Dio_WriteOutputs(IoDal_BswChannelIdType BswIoCh
         {
             
             case IODAL_DIO_OUTPUT:
+#if (IODAL_DIO_OUTPUT_BATCH == STD_ON)
+                Slot = IoDal_DioBatchSlot[DioDescriptorIndex];
+                PinMask = (Dio_PortLevelType)1U << (ChannelId & IODAL_DIO_PIN_MASK);
+
+                if ((Dio_LevelType)STD_LOW != (Dio_LevelType)OutputValue)
+                {
+                    IoDal_DioBatchLevel[Slot] |= PinMask;
+                }
+                else
+                {
+                    IoDal_DioBatchLevel[Slot] &= ~PinMask;
+                }
+                IoDal_DioBatchMask[Slot] |= PinMask;
+#else
                 Dio_WriteChannel((Dio_ChannelType)ChannelId, (Dio_LevelType)OutputValue);
+#endif
             break;
                     
             case IODAL_TIMER_OUTPUT:
@@ -45,6 +45,9 @@ extern "C"{
 #include "IoDal_Cfg.h"
 #include "IoDal_Pwm.h"
 #include "Pwm.h"
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+#include "SysDal.h"
+#endif
 /*===============================================================================================================================
                                        SOURCE FILE VERSION INFORMATION
 ================================================================================================================================*/
@@ -125,6 +128,15 @@ extern "C"{
 ================================================================================================================================*/
 #define PWM_DUTY_CYCLE_MAX_VALUE 0x8000U
 
+#if (IODAL_PWM_SYNC == STD_ON)
+#if (IODAL_PWM_SYNC_BATCH == STD_ON) && (PWM_HW_MODULES_CFG_U8 > 32U)
+    #error "IODAL_PWM_SYNC_BATCH supports up to 32 Pwm hardware modules"
+#endif
+#if (PWM_SYNC_UPDATE_API != STD_ON) || (PWM_SET_DUTY_CYCLE_NO_UPDATE_API != STD_ON)
+    #error "IODAL_PWM_SYNC requires PWM_SYNC_UPDATE_API and PWM_SET_DUTY_CYCLE_NO_UPDATE_API"
+#endif
+#endif
+
 
 /*===============================================================================================================================
                                              FILE VERSION CHECKS
@@ -167,6 +179,36 @@ static VAR(uint16,  AUTOMATIC) IoDal_PwmDutyValue[IODAL_MAX_PWM_DESCRIPTORS];
 static VAR(Pwm_PeriodType, AUTOMATIC) IoDal_PwmPeriodValue[IODAL_MAX_PWM_DESCRIPTORS]; 
 #endif
 
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_ON)
+/**
+* @brief          Pwm hardware modules with duty cycles staged since the last IoDal_Pwm_FlushOutputs, bit n for module n.
+*
+*/
+static VAR(uint32, AUTOMATIC) IoDal_PwmSyncPendingModules = 0U;
+
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+/**
+* @brief          Staged submodules of every Pwm hardware module.
+*
+*/
+static VAR(uint16, AUTOMATIC) IoDal_PwmSyncPendingMask[PWM_HW_MODULES_CFG_U8];
+#endif
+#endif
+
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+/**
+* @brief          Cost of the IODAL_PWM_SYNC_OUTPUT channels, read with the debugger.
+*
+*/
+VAR(IoDal_PwmSyncBenchmarkType, IODAL_VAR) IoDal_PwmSyncBenchmark = {0U, 0U, 0U, 0U, 0U};
+
+/**
+* @brief          Cost accumulated since the last IoDal_Pwm_FlushOutputs.
+*
+*/
+static VAR(IoDal_PwmSyncBenchmarkType, IODAL_VAR) IoDal_PwmSyncBenchmarkCycle = {0U, 0U, 0U, 0U, 0U};
+#endif
+
 
 /*===============================================================================================================================
                                                 LOCAL FUNCTION PROTOTYPES
@@ -193,6 +235,9 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
     VAR(IoDal_Pwm_InitCalloutType, AUTOMATIC)   pfInitCallout;
     P2CONST(IoDal_Pwm_ExtDev_Config, AUTOMATIC, IODAL_APPL_CONST)   pcInitData;
     #endif
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_ON) && (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+    VAR(uint8, AUTOMATIC) PwmSyncTimer;
+#endif
     IoDal_pPwmGlobalCfgPtr = ConfigPtr;
 
     
@@ -225,6 +270,16 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_Init(P2CONST(IoDal_BswIoConfigType, AUTOMAT
     #endif
 
     }        
+
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_ON)
+    IoDal_PwmSyncPendingModules = 0U;
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+    for (PwmSyncTimer = 0U; PwmSyncTimer < PWM_HW_MODULES_CFG_U8; PwmSyncTimer++)
+    {
+        IoDal_PwmSyncPendingMask[PwmSyncTimer] = 0U;
+    }
+#endif
+#endif
 }
 
 /*==============================================================================================================================*/
@@ -274,6 +329,10 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_DeInit(void)
     
     }
     
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_ON)
+    IoDal_PwmSyncPendingModules = 0U;
+#endif
+
     IoDal_pPwmGlobalCfgPtr = NULL_PTR;
 
 }
@@ -295,16 +354,18 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_DeInit(void)
 /*==============================================================================================================================*/
 FUNC(void, IODAL_APP_CODE) IoDal_Pwm_OutputResync(IoDal_BswChannelIdType BswIoChannel)
 {        
-    VAR(IoDal_BswChannelType, AUTOMATIC) ChannelType;
     VAR(uint8, AUTOMATIC)                PwmDescriptorIndex;
     VAR(uint8, AUTOMATIC)                PwmSyncTimer;
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
     VAR(uint16, AUTOMATIC)               PwmSyncMask;
+#endif
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+    VAR(uint32, AUTOMATIC)               BenchmarkStart = SysDal_GetCycleCount();
+#endif
     
-
-    PwmDescriptorIndex    =  ((IoDal_pPwmGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
-        
     if(NULL_PTR != IoDal_pPwmGlobalCfgPtr)
     {
+        PwmDescriptorIndex    =  ((IoDal_pPwmGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
                 
         if(TRUE == IoDal_PwmResyncRequest[PwmDescriptorIndex])
         {    
@@ -312,12 +373,90 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_OutputResync(IoDal_BswChannelIdType BswIoCh
             IoDal_PwmResyncRequest[PwmDescriptorIndex] = FALSE;
 
             /*get sync information from Pwm descriptor*/
-            PwmSyncTimer    =  (*((((IoDal_pPwmGlobalCfgPtr->pPwmChanDescriptor))[PwmDescriptorIndex]).pIntPwmChannelCfg))->UsedSyncPwmTimer;
-            PwmSyncMask    =  (*((((IoDal_pPwmGlobalCfgPtr->pPwmChanDescriptor))[PwmDescriptorIndex]).pIntPwmChannelCfg))->SubmoduleMask;
+            PwmSyncTimer    =  ((((IoDal_pPwmGlobalCfgPtr->pPwmChanDescriptor))[PwmDescriptorIndex]).pIntPwmChannelCfg)->UsedSyncPwmTimer;
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+            PwmSyncMask    =  ((((IoDal_pPwmGlobalCfgPtr->pPwmChanDescriptor))[PwmDescriptorIndex]).pIntPwmChannelCfg)->SubmoduleMask;
             Pwm_SyncUpdate(PwmSyncTimer, PwmSyncMask);            
+#else
+            Pwm_SyncUpdate(PwmSyncTimer);            
+#endif
+
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+            IoDal_PwmSyncBenchmarkCycle.DriverCalls++;
+            IoDal_PwmSyncBenchmarkCycle.SyncUpdates++;
+            IoDal_PwmSyncBenchmarkCycle.Cycles += SysDal_GetCycleCount() - BenchmarkStart;
+#endif
         }
     }
 }
+
+/*==============================================================================================================================*/
+/**
+@brief      IoDal_Pwm_FlushOutputs - Commits the duty cycles staged on the IODAL_PWM_SYNC_OUTPUT channels
+@details    With IODAL_PWM_SYNC_BATCH the duty cycles written during the cycle are only staged in the FTM
+            buffer registers by IoDal_Pwm_WriteDuty. This function issues one Pwm_SyncUpdate per FTM module 
+            with staged channels, so all channels of a module (e.g. the RGB channels of a lamp) switch to their
+            new duty cycle on the same PWM period. 
+            Without IODAL_PWM_SYNC_BATCH the channels are synchronized one by one by IoDal_Pwm_OutputResync and
+            this function only closes the IODAL_PWM_SYNC_BENCHMARK measurement of the cycle.
+
+@return     void
+@retval     
+
+@pre        Called from the task context issuing IoDal_Pwm_WriteDuty
+@post None
+*/
+/*==============================================================================================================================*/
+FUNC(void, IODAL_APP_CODE) IoDal_Pwm_FlushOutputs(void)
+{
+#if (IODAL_PWM_SYNC_BATCH == STD_ON)
+    VAR(uint8, AUTOMATIC)                PwmSyncTimer = 0U;
+    VAR(uint32, AUTOMATIC)               PendingModules = IoDal_PwmSyncPendingModules;
+#endif
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+    VAR(uint32, AUTOMATIC)               BenchmarkStart = SysDal_GetCycleCount();
+#endif
+
+#if (IODAL_PWM_SYNC_BATCH == STD_ON)
+    IoDal_PwmSyncPendingModules = 0U;
+
+    while (0U != PendingModules)
+    {
+        if (0U != (PendingModules & 1UL))
+        {
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+            Pwm_SyncUpdate(PwmSyncTimer, IoDal_PwmSyncPendingMask[PwmSyncTimer]);
+            IoDal_PwmSyncPendingMask[PwmSyncTimer] = 0U;
+#else
+            Pwm_SyncUpdate(PwmSyncTimer);
+#endif
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+            IoDal_PwmSyncBenchmarkCycle.DriverCalls++;
+            IoDal_PwmSyncBenchmarkCycle.SyncUpdates++;
+#endif
+        }
+        PendingModules >>= 1U;
+        PwmSyncTimer++;
+    }
+#endif
+
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+    IoDal_PwmSyncBenchmarkCycle.Cycles += SysDal_GetCycleCount() - BenchmarkStart;
+
+    /*publish the cost of the cycle*/
+    IoDal_PwmSyncBenchmarkCycle.CycleCount = IoDal_PwmSyncBenchmark.CycleCount + 1U;
+    IoDal_PwmSyncBenchmarkCycle.CyclesMax = IoDal_PwmSyncBenchmark.CyclesMax;
+    if (IoDal_PwmSyncBenchmarkCycle.Cycles > IoDal_PwmSyncBenchmarkCycle.CyclesMax)
+    {
+        IoDal_PwmSyncBenchmarkCycle.CyclesMax = IoDal_PwmSyncBenchmarkCycle.Cycles;
+    }
+    IoDal_PwmSyncBenchmark = IoDal_PwmSyncBenchmarkCycle;
+
+    IoDal_PwmSyncBenchmarkCycle.Cycles = 0U;
+    IoDal_PwmSyncBenchmarkCycle.DriverCalls = 0U;
+    IoDal_PwmSyncBenchmarkCycle.SyncUpdates = 0U;
+#endif
+}
 #endif
 
 #if (IODAL_PWM_EXT_DEV == STD_ON)
@@ -395,6 +534,12 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_WriteDuty(IoDal_BswChannelIdType BswIoChann
     VAR(Pwm_ChannelType, AUTOMATIC)      PwmChannel;
     VAR(uint8, AUTOMATIC)                PwmDescriptorIndex;
     VAR(IoDal_BswChannelType, AUTOMATIC) ChannelType;
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BATCH == STD_ON)
+    P2CONST(IoDal_InternalPwmConfig, AUTOMATIC, IODAL_APPL_CONST) pSyncCfg;
+#endif
+#if (IODAL_PWM_SYNC == STD_ON) && (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+    VAR(uint32, AUTOMATIC)               BenchmarkStart;
+#endif
     
     PwmDescriptorIndex    =  ((IoDal_pPwmGlobalCfgPtr->pBswChannelMap))[BswIoChannel].BswDescriptorIndex;
     
@@ -424,8 +569,24 @@ FUNC(void, IODAL_APP_CODE) IoDal_Pwm_WriteDuty(IoDal_BswChannelIdType BswIoChann
             
 #if (IODAL_PWM_SYNC == STD_ON)            
         case IODAL_PWM_SYNC_OUTPUT:
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+             BenchmarkStart = SysDal_GetCycleCount();
+#endif
              Pwm_SetDutyCycle_NoUpdate(PwmChannel, OutputDutyValue);    
+#if (IODAL_PWM_SYNC_BATCH == STD_ON)
+             /*committed for the whole FTM module by IoDal_Pwm_FlushOutputs*/
+             pSyncCfg = (((IoDal_pPwmGlobalCfgPtr->pPwmChanDescriptor))[PwmDescriptorIndex]).pIntPwmChannelCfg;
+             IoDal_PwmSyncPendingModules |= (uint32)1UL << pSyncCfg->UsedSyncPwmTimer;
+#if (PWM_ALLOW_SUBMODULE_SYNC == STD_ON)
+             IoDal_PwmSyncPendingMask[pSyncCfg->UsedSyncPwmTimer] |= pSyncCfg->SubmoduleMask;
+#endif
+#else
              IoDal_PwmResyncRequest[PwmDescriptorIndex] = TRUE;
+#endif
+#if (IODAL_PWM_SYNC_BENCHMARK == STD_ON)
+             IoDal_PwmSyncBenchmarkCycle.DriverCalls++;
+             IoDal_PwmSyncBenchmarkCycle.Cycles += SysDal_GetCycleCount() - BenchmarkStart;
+#endif
         break;
 #endif        
     }        
@@ -37,6 +37,7 @@ extern "C"{
 ====================================================================================================================*/
 #include "SysDal.h"
 #include "SysDal_Cfg.h"
+#include "SysDal_Defer.h"
 #include "Mcu.h"
 #include "sys_init.h"
 #include "typedefs.h"
@@ -101,6 +102,19 @@ extern "C"{
     )
     #error "Software Version Numbers of SysDal.c and SysDal_Cfg.h are different"
 #endif
+/*==================================================================================================
+                                        LOCAL MACROS
+==================================================================================================*/
+#if (SYSDAL_FAST_BOOT == STD_ON) && (SYSDAL_BOOT_NUMBER_OF_STEPS == 0U)
+    #error "SYSDAL_FAST_BOOT requires at least one background init step"
+#endif
+
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+/* Cortex-M4 System Control Register, SLEEPDEEP is left set by Mcu_SetMode for the stop modes */
+#define SYSDAL_SCB_SCR_ADDR32               ((uint32)0xE000ED10UL)
+#define SYSDAL_SCB_SCR_SLEEPDEEP_U32        ((uint32)0x00000004UL)
+#endif
+
 /*==================================================================================================
                                        GLOBAL CONSTANTS
 ==================================================================================================*/
@@ -115,20 +129,59 @@ Mcu_ResetType ResetReason;
 extern const vuint32_t IntcVectorTableHw[];
 #endif
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
+volatile SysDal_BootStageType SysDal_BootStage = SYSDAL_BOOT_RESET;
+SysDal_BootTimestampsType SysDal_BootTimestamps;
+#endif
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+volatile SysDal_LatencyMeasurementType SysDal_LatencyMeasurement = SYSDAL_LATENCY_IDLE;
+SysDal_WakeupLatencyType SysDal_WakeupLatency = {0U, 0U, 0xFFFFFFFFUL, 0U, 0U, 0U};
+#endif
+
+/*==================================================================================================
+                                       LOCAL VARIABLES
+==================================================================================================*/
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+/* Set by the wakeup notification, cleared before entering the sleep mode */
+static volatile boolean SysDal_WakeupEventDetected = FALSE;
+/* Set by SysDal_MainFunction when no user requests SYSDAL_STATE_UP, served by SysDal_EnterSleepMode */
+static volatile boolean SysDal_SleepRequested = FALSE;
+#endif
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+/* Cycle counter value at the start of the path being measured */
+static uint32 SysDal_LatencyStartTime = 0U;
+#endif
+
+#if (SYSDAL_FAST_BOOT == STD_ON)
+/* Cycle counter value at SysDal_Init entry */
+static uint32 SysDal_BootStartTime = 0U;
+/* Next background init step to run */
+static uint8 SysDal_BootStepIdx = 0U;
+#endif
+
 /*===============================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ===============================================================================================*/
-FUNC (void, ICU_CODE) WakeUpNotification(void);
-#if 0
-FUNC (void, SAMPLE_APP_CODE) SysDal_PrepareGoToSleep(void);
-FUNC (void, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void);
+static FUNC (void, SAMPLE_APP_CODE) SysDal_StartClock(void);
+static FUNC (void, SAMPLE_APP_CODE) SysDal_DistributeClock(void);
+#if (SYSDAL_FAST_BOOT == STD_ON)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_SetBootStage(SysDal_BootStageType Stage);
+#endif
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_PrepareGoToSleep(void);
+static FUNC (boolean, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void);
+static FUNC (void, SAMPLE_APP_CODE) SysDal_Resume(void);
 #endif
 /*===============================================================================================
 *                                       LOCAL FUNCTIONS
 ===============================================================================================*/
 /**
 @brief      WakeUpNotification - Notification generated at wakeup
-@details    Shall be used to reinitialise the system 
+@details    Shall be called by the wakeup sources (IoDal reports the digital input edges).
+            Only records the event, the system is resumed by SysDal_EnterSleepMode once the
+            wakeup has been validated.
             
 @return     None
 
@@ -137,38 +190,148 @@ FUNC (void, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void);
 */
 FUNC (void, ICU_CODE) WakeUpNotification(void)
 {
-    SysDal_Init();
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+    SysDal_WakeupEventDetected = TRUE;
+#endif
 }
 
-#if 0 
+/**
+@brief      SysDal_StartClock - Start the clock sources
+@details    Configures the clock sources and starts the PLL without waiting for its lock.
+            Used at start-up and to restore the clocks disabled by the sleep mode.
+            
+@return     None
+
+@pre        Mcu_Init has been called
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_StartClock(void)
+{
+#if (USE_MCU_MODULE == STD_ON)
+    Mcu_InitClock(McuClockSettingConfig_0);
+#endif
+}
+
+/**
+@brief      SysDal_DistributeClock - Switch the system clock to the PLL
+@details    Waits for the PLL lock started by SysDal_StartClock and switches the clock tree to it.
+            
+@return     None
+
+@pre        SysDal_StartClock has been called
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_DistributeClock(void)
+{
+#if (USE_MCU_MODULE == STD_ON)
+#if(MCU_NO_PLL==STD_OFF)
+    while ( MCU_PLL_LOCKED != Mcu_GetPllStatus() ) 
+    {
+       /* wait until all enabled PLLs are locked */
+    }
+    /* switch system clock tree to PLL */
+    Mcu_DistributePllClock();
+#endif
+#endif
+}
+
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
 /**
 @brief      SysDal_PrepareGoToSleep - Function used to prepare entering the LowPower mode
-@details    
+@details    Stops the task activations and leaves only the wakeup sources enabled.
+            The drivers are not de-initialised: the sleep mode retains all peripheral
+            registers, only the clock sources are switched off by Mcu_SetMode.
             
 @return     None
 
 @pre None
 @post None
 */
-FUNC (void, SAMPLE_APP_CODE) SysDal_PrepareGoToSleep(void)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_PrepareGoToSleep(void)
 {
-    /*Actions before going to sleep*/
-}
+#if defined(AUTOSAR_OS_NOT_USED)
+    SysDal_IntSch_StopScheduler();
 #endif
+    SysDal_WakeupEventDetected = FALSE;
+    /*Enable the wakeup events, mask all other interrupt sources*/
+    SysDal_Config.SetWakeupEventsCallout();
+}
 
-#if 0 
 /**
 @brief      SysDal_ValidateWakeupReason - Function used to validate a WakeUp
-@details    
+@details    A wakeup is valid when it was reported through WakeUpNotification. Any other
+            interrupt leaving the sleep mode is counted as spurious.
+            
+@return     boolean
+@retval     TRUE    Valid wakeup, the system shall be resumed
+@retval     FALSE   Spurious wakeup, the system shall go back to sleep
+
+@pre None
+@post None
+*/
+static FUNC (boolean, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void)
+{
+    boolean ValidWakeupReason = SysDal_WakeupEventDetected;
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+    if (FALSE == ValidWakeupReason)
+    {
+        SysDal_WakeupLatency.SpuriousWakeupCount++;
+    }
+#endif
+    return ValidWakeupReason;
+}
+
+/**
+@brief      SysDal_Resume - Fast resume after a valid wakeup
+@details    Restores only what the sleep mode lost: the clock tree and the task activations.
+            Driver configuration and application state are kept, so no driver is re-initialised.
+            
+@return     None
+
+@pre        Called after leaving the sleep mode, interrupts enabled
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_Resume(void)
+{
+    SysDal_EcuModeUsersType UserId;
+
+    /* WFI in the idle loop shall not enter the stop mode again */
+    REG_BIT_CLEAR32(SYSDAL_SCB_SCR_ADDR32, SYSDAL_SCB_SCR_SLEEPDEEP_U32);
+    SysDal_StartClock();
+    SysDal_DistributeClock();
+
+    for (UserId = 0U; UserId < SYSDAL_USERS; UserId++)
+    {
+        UserRequest[UserId] = SYSDAL_STATE_UP;
+    }
+    /*Disable all wakeup events -- system is running*/
+    SysDal_Config.ClearWakeupEventsCallout();
+#if defined(AUTOSAR_OS_NOT_USED)
+    SysDal_IntSch_ResumeScheduler();
+#endif
+    SysDal_State = SYSDAL_STATE_UP;
+}
+#endif
+
+#if (SYSDAL_FAST_BOOT == STD_ON)
+/**
+@brief      SysDal_SetBootStage - Enter the next boot stage
+@details    Timestamps the end of the current stage and lets the scheduler dispatch the tasks
+            waiting for the new one.
             
 @return     None
 
 @pre None
 @post None
 */
-FUNC (void, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_SetBootStage(SysDal_BootStageType Stage)
 {
-    /*Validate WakeUp reason*/
+    SysDal_BootTimestamps.StageTime[Stage] = SysDal_GetCycleCount() - SysDal_BootStartTime;
+    SysDal_BootStage = Stage;
+#if defined(AUTOSAR_OS_NOT_USED)
+    SysDal_IntSch_SetBootStage(Stage);
+#endif
 }
 #endif
 /*===============================================================================================
@@ -178,6 +341,10 @@ FUNC (void, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void)
 @brief      SysDal_Init - Initialization function for System Driver abstraction module
 @details    Shall be used to set all Interrupts used by the system 
             Shall be used to initialize all drivers before starting the system
+            Only called at start-up, a wakeup from the sleep mode is handled by SysDal_EnterSleepMode.
+            With SYSDAL_FAST_BOOT only the critical drivers are initialised before the scheduler
+            starts, the PLL independent ones while the PLL locks. The slow drivers are left to
+            SysDal_RunBootStep and the tasks are held back until their boot stage is reached.
             
 @return     None
 
@@ -186,69 +353,63 @@ FUNC (void, SAMPLE_APP_CODE) SysDal_ValidateWakeupReason(void)
 */
 FUNC (void, SAMPLE_APP_CODE) SysDal_Init(void)
 {
-#if 0
-    /*Used in future implementation - validation for WakeUp*/
-    boolean ValidWakeupReason = TRUE;    
-#endif
     uint8 UserId = 0;
     SysDal_State = SYSDAL_STATE_STARTUP;        
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON) || (SYSDAL_FAST_BOOT == STD_ON)
+    SysDal_EnableCycleCounter();
+#endif
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+    SysDal_LatencyStartTime = SysDal_GetCycleCount();
+    SysDal_LatencyMeasurement = SYSDAL_LATENCY_COLD_INIT;
+#endif
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    SysDal_BootStartTime = SysDal_GetCycleCount();
+    SysDal_BootStepIdx = 0U;
+    SysDal_SetBootStage(SYSDAL_BOOT_RESET);
+#endif
    
 #if (USE_MCU_MODULE == STD_ON)
     Mcu_Init(&McuModuleConfiguration);
-    Mcu_InitClock(McuClockSettingConfig_0);
-#if(MCU_NO_PLL==STD_OFF)
-    while ( MCU_PLL_LOCKED != Mcu_GetPllStatus() ) 
-    {
-       /* wait until all enabled PLLs are locked */
-    }
-    /* switch system clock tree to PLL */
-    Mcu_DistributePllClock();
 #endif
+    SysDal_StartClock();
+#if (SYSDAL_FAST_BOOT == STD_OFF)
+    SysDal_DistributeClock();
 #endif
 
     for (UserId = 0; UserId < SYSDAL_USERS; UserId++)
     {
         UserRequest[UserId] = SYSDAL_STATE_UP;
     } 
+    /*deferred work queues shall be empty before the producer interrupts are enabled*/
+    SysDal_Defer_Init();
     /*set interrupts priority*/
     SysDal_Config.SetProgrammableInterruptsCallout();   
-#if 0
-    /*Used in future implementation - validation for WakeUp*/
-    SysDal_ValidateWakeupReason();
-    if (FALSE == ValidWakeupReason)       
-    {
-       /*No valid wakeup go  back to configured Sleep Mode*/
-#if (SYSDAL_LOW_POWER_MODE == STD_ON)    
-       SysDal_Config.SetWakeupEventsCallout();
-#endif        
-       SysDal_State = SYSDAL_STATE_SLEEP;    
-       /*Set MCU to Sleep Mode*/
-       Mcu_SetMode((Mcu_ModeType) 1);
-#if defined(AUTOSAR_OS_NOT_USED)        
-       SysDal_IntSch_StopScheduler();
-#else
-       StopOS();/*Stop OS*/
-#endif                
-   }
-   else
-#endif
-   {
-       /*Valid wakeup go to Up Mode*/
-       SysDal_Config.InitDriversCallout();
+
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    /*overlap the PLL lock with the drivers running from the reset clock*/
+    SysDal_Config.EarlyInitDriversCallout();
+    SysDal_SetBootStage(SYSDAL_BOOT_EARLY);
+    SysDal_DistributeClock();
+    SysDal_SetBootStage(SYSDAL_BOOT_CLOCK);
+#endif
+    SysDal_Config.InitDriversCallout();
 #if (SYSDAL_LOW_POWER_MODE == STD_ON)          
-       /*Disable all wakeup events -- system is running*/
-       SysDal_Config.ClearProgrammableInterruptsCallout();
+    /*Disable all wakeup events -- system is running*/
+    SysDal_Config.ClearWakeupEventsCallout();
+#endif
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    /*the remaining drivers are initialised by SysDal_RunBootStep*/
+    SysDal_SetBootStage(SYSDAL_BOOT_CRITICAL);
 #endif
  
 #if defined(AUTOSAR_OS_NOT_USED)        
-       SysDal_IntSch_StartScheduler();
+    SysDal_IntSch_StartScheduler();
 #else
-       StartOS();
+    StartOS();
 #endif    
-       SysDal_State=SYSDAL_STATE_UP;
-       /*Set MCU to Up Mode*/
-       Mcu_SetMode((Mcu_ModeType) 0);
-    }    
+    SysDal_State=SYSDAL_STATE_UP;
+    /*Set MCU to Up Mode*/
+    Mcu_SetMode(SYSDAL_MCU_RUN_MODE);
 }
 
 /*Call from SWC to change the ECU mode*/
@@ -261,6 +422,9 @@ FUNC(void, SAMPLE_APP_CODE) SysDal_WriteModeRequest(SysDal_EcuModeUsersType User
 @brief      SysDal_Main - Main function for System Driver abstraction module
 @details    Shall be used to compute the request for LowPower mode based on users request (from SWC)
             Shall be used to set the request LowPower 
+            When no user requests SYSDAL_STATE_UP the sleep mode is only requested, it is entered
+            by SysDal_EnterSleepMode once the calling task has returned. Without the internal
+            scheduler the sleep mode is entered from here.
             
 @return     None
 
@@ -271,44 +435,162 @@ FUNC(void, SAMPLE_APP_CODE) SysDal_WriteModeRequest(SysDal_EcuModeUsersType User
 FUNC (void, SAMPLE_APP_CODE) SysDal_MainFunction(void)
 {
 #if (SYSDAL_LOW_POWER_MODE == STD_ON)     
-    static SysDal_EcuModeType CurrentEcuMode = SYSDAL_STATE_UP;    
-    boolean GoToSlepp = TRUE;
+    boolean GoToSleep = TRUE;
     SysDal_EcuModeUsersType UserId = 0;
      
-    GoToSlepp = TRUE;
     for (UserId = 0; UserId < SYSDAL_USERS; UserId++)
     {
         if (SYSDAL_STATE_UP == UserRequest[UserId])
         {
-            GoToSlepp = FALSE;
+            GoToSleep = FALSE;
         }
         else
         {
             /*do nothing*/
         }
     }
-#if 0   
-/*Used in future implementation - Sleep/WakeUp*/
-    if (TRUE == GoToSlepp)
+
+    if (TRUE == GoToSleep)
     {
-        /*Enable all wakeup events -- system is running*/
-        SysDal_Config.SetProgrammableInterruptsCallout();
-        SysDal_PrepareGoToSleep();
-        SysDal_State = SYSDAL_STATE_SLEEP;
-        CurrentEcuMode = SysDal_State;
-        /*Set Mcu_SleepMode*/
-        Mcu_SetMode((Mcu_ModeType) 1);
+        SysDal_SleepRequested = TRUE;
+#if !defined(AUTOSAR_OS_NOT_USED)
+        (void)SysDal_EnterSleepMode();
+#endif
     }    
     else
-#endif
     {
+        SysDal_SleepRequested = FALSE;
         SysDal_State = SYSDAL_STATE_UP;
-        CurrentEcuMode = SysDal_State;
     }
 #endif        
 }
 
-#ifdef __cplusplus
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+/**
+@brief      SysDal_EnterSleepMode - Enter the sleep mode requested by SysDal_MainFunction
+@details    Shall be called in idle time, outside of any task (the internal scheduler calls it
+            when no task is ready), so that no task activation is blocked by the sleep mode.
+            The call only returns after a valid wakeup, with the clocks and the scheduler restored.
+            Spurious wakeups are served at the sleep mode clock and the MCU goes back to sleep.
+            
+@return     boolean
+@retval     TRUE    The sleep mode was requested, the system has been resumed
+@retval     FALSE   No sleep request pending
+
+@pre None
+@post None
+*/
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_EnterSleepMode(void)
+{
+    boolean SleepRequested = SysDal_SleepRequested;
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+    uint32 WakeupTime = 0U;
+#endif
+
+    if (TRUE == SleepRequested)
+    {
+        SysDal_SleepRequested = FALSE;
+        SysDal_PrepareGoToSleep();
+        SysDal_State = SYSDAL_STATE_SLEEP;
+        do
+        {
+            /* a wakeup interrupt raised from here on keeps the core out of the sleep mode */
+            sys_disableAllInterrupts();
+            if (FALSE == SysDal_WakeupEventDetected)
+            {
+                /*Set Mcu_SleepMode, returns on the first enabled interrupt*/
+                Mcu_SetMode(SYSDAL_MCU_SLEEP_MODE);
+            }
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+            WakeupTime = SysDal_GetCycleCount();
+#endif
+            /* serve the pending interrupt, the wakeup notification validates it */
+            sys_enableAllInterrupts();
+        } while (FALSE == SysDal_ValidateWakeupReason());
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+        SysDal_LatencyStartTime = WakeupTime;
+        SysDal_LatencyMeasurement = SYSDAL_LATENCY_RESUME;
+#endif
+        SysDal_Resume();
+    }
+    return SleepRequested;
+}
+#endif
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+/**
+@brief      SysDal_RecordFirstTaskLatency - Record the start-up latency
+@details    Shall be called by the scheduler right before dispatching a task while
+            SysDal_LatencyMeasurement is not SYSDAL_LATENCY_IDLE.
+            Stores the cycles elapsed since SysDal_Init entry or since the exit of the sleep
+            mode in SysDal_WakeupLatency. The clocks are restored within the measured
+            interval, the value is a count of core cycles at the clock in use, not a time.
+            
+@return     None
+
+@pre None
+@post       SysDal_LatencyMeasurement is SYSDAL_LATENCY_IDLE
+*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_RecordFirstTaskLatency(void)
+{
+    uint32 Latency = SysDal_GetCycleCount() - SysDal_LatencyStartTime;
+
+    if (SYSDAL_LATENCY_COLD_INIT == SysDal_LatencyMeasurement)
+    {
+        SysDal_WakeupLatency.ColdInitLatency = Latency;
+    }
+    else
+    {
+        SysDal_WakeupLatency.ResumeLatencyLast = Latency;
+        if (Latency < SysDal_WakeupLatency.ResumeLatencyMin)
+        {
+            SysDal_WakeupLatency.ResumeLatencyMin = Latency;
+        }
+        if (Latency > SysDal_WakeupLatency.ResumeLatencyMax)
+        {
+            SysDal_WakeupLatency.ResumeLatencyMax = Latency;
+        }
+        SysDal_WakeupLatency.ResumeCount++;
+    }
+    SysDal_LatencyMeasurement = SYSDAL_LATENCY_IDLE;
 }
 #endif
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
+/**
+@brief      SysDal_RunBootStep - Run the next background init step
+@details    Shall be called in idle time once the scheduler runs (the internal scheduler calls
+            it when no task is ready, with an OS it shall be called from the background task).
+            Each step runs to completion, slow driver inits shall be split in several steps.
+            The boot is complete after the last step.
+            
+@return     boolean
+@retval     TRUE    A step has been run
+@retval     FALSE   No step left
+
+@pre        SysDal_Init has been called
+@post None
+*/
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_RunBootStep(void)
+{
+    boolean StepDone = FALSE;
+
+    if (SysDal_BootStepIdx < SYSDAL_BOOT_NUMBER_OF_STEPS)
+    {
+        SysDal_Config.BootSteps[SysDal_BootStepIdx]();
+        SysDal_BootTimestamps.StepTime[SysDal_BootStepIdx] = SysDal_GetCycleCount() - SysDal_BootStartTime;
+        SysDal_BootStepIdx++;
+        if (SYSDAL_BOOT_NUMBER_OF_STEPS == SysDal_BootStepIdx)
+        {
+            SysDal_SetBootStage(SYSDAL_BOOT_COMPLETE);
+        }
+        StepDone = TRUE;
+    }
+    return StepDone;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,251 @@
+/**
+*   @file           SysDal_Defer.c
+*   @version        1.0.1
+*
+*   @brief          Integration Framework - SysDal deferred work queues.
+*   @details        Lock-free queues moving work from interrupt handlers to task context.
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2018 NXP
+*   All Rights Reserved.
+*   This file contains sample code only. It is not part of the production code deliverables.
+*
+*   @addtogroup SYSDAL
+*   @{
+*/
+/*==================================================================================================
+*   Platform             : ARM
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   SW Version           : 1.0.1
+*   Build Version        : S32K14x_MCAL_1_0_1_RTM_ASR_REL_4_2_REV_0002_20170831
+*
+============================================================================================================================*/
+/*============================================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+                                         INCLUDE FILES
+ 1) system and project includes
+ 2) needed interfaces from external units
+ 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "SysDal.h"
+#include "SysDal_Defer.h"
+
+/*===================================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+====================================================================================================================*/
+#define SYSDAL_DEFER_VENDOR_ID_C                       43
+
+#define SYSDAL_DEFER_AR_RELEASE_MAJOR_VERSION_C        4
+#define SYSDAL_DEFER_AR_RELEASE_MINOR_VERSION_C        2
+#define SYSDAL_DEFER_AR_RELEASE_REVISION_VERSION_C     2
+
+#define SYSDAL_DEFER_SW_MAJOR_VERSION_C                1
+#define SYSDAL_DEFER_SW_MINOR_VERSION_C                0
+#define SYSDAL_DEFER_SW_PATCH_VERSION_C                1
+/*===================================================================================================================
+*                                       FILE VERSION CHECKS
+====================================================================================================================*/
+/**
+* @file           SysDal_Defer.c
+*/
+/* Check if source file and SYSDAL_DEFER header file are of the same vendor */
+#if (SYSDAL_DEFER_VENDOR_ID_C != SYSDAL_DEFER_VENDOR_ID)
+    #error "SysDal_Defer.c and SysDal_Defer.h have different vendor ids"
+#endif
+
+/* Check if source file and SYSDAL_DEFER header file are of the same Autosar version */
+#if ((SYSDAL_DEFER_AR_RELEASE_MAJOR_VERSION_C != SYSDAL_DEFER_AR_RELEASE_MAJOR_VERSION) || \
+     (SYSDAL_DEFER_AR_RELEASE_MINOR_VERSION_C != SYSDAL_DEFER_AR_RELEASE_MINOR_VERSION) || \
+     (SYSDAL_DEFER_AR_RELEASE_REVISION_VERSION_C != SYSDAL_DEFER_AR_RELEASE_REVISION_VERSION) \
+    )
+    #error "AutoSar Version Numbers of SysDal_Defer.c and SysDal_Defer.h are different"
+#endif
+
+/* Check if source file and SYSDAL_DEFER header file are of the same Software version */
+#if ((SYSDAL_DEFER_SW_MAJOR_VERSION_C != SYSDAL_DEFER_SW_MAJOR_VERSION) || \
+     (SYSDAL_DEFER_SW_MINOR_VERSION_C != SYSDAL_DEFER_SW_MINOR_VERSION) || \
+     (SYSDAL_DEFER_SW_PATCH_VERSION_C != SYSDAL_DEFER_SW_PATCH_VERSION) \
+    )
+    #error "Software Version Numbers of SysDal_Defer.c and SysDal_Defer.h are different"
+#endif
+
+/*==================================================================================================
+                                        LOCAL MACROS
+==================================================================================================*/
+#if ((SYSDAL_DEFER_QUEUE_SIZE & (SYSDAL_DEFER_QUEUE_SIZE - 1U)) != 0U) || (SYSDAL_DEFER_QUEUE_SIZE > 128U)
+    #error "SYSDAL_DEFER_QUEUE_SIZE shall be a power of two not greater than 128"
+#endif
+
+#define SYSDAL_DEFER_QUEUE_MASK             ((uint8)(SYSDAL_DEFER_QUEUE_SIZE - 1U))
+
+/* SysDal_Defer_Process is only called by the internal scheduler loop, with an OS no task would
+   drain the queues and the producers would fall back to doing their work in interrupt context */
+#if !defined(AUTOSAR_OS_NOT_USED) && (SYSDAL_DEFER_NUMBER_OF_QUEUES > 0U)
+    #error "The SysDal deferred work queues are only drained by the internal scheduler (AUTOSAR_OS_NOT_USED)"
+#endif
+
+/*==================================================================================================
+                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+typedef struct
+{
+    SysDal_Defer_WorkFuncType WorkFunc;
+    uint32 WorkArg;
+}SysDal_Defer_WorkItemType;
+
+/**
+* @brief    Single producer / single consumer ring.
+* @details  Head is only written by the producing interrupt handler and Tail only by the task
+*           draining the queue, so no lock is needed. Both are free running and wrap at 256,
+*           the slot index is taken with SYSDAL_DEFER_QUEUE_MASK.
+*/
+typedef struct
+{
+    volatile SysDal_Defer_WorkItemType Item[SYSDAL_DEFER_QUEUE_SIZE];
+    volatile uint8 Head;
+    volatile uint8 Tail;
+    uint16 OverflowCount;
+}SysDal_Defer_QueueType;
+
+/*==================================================================================================
+                                       LOCAL VARIABLES
+==================================================================================================*/
+static SysDal_Defer_QueueType SysDal_Defer_Queue[SYSDAL_DEFER_NUMBER_OF_QUEUES];
+
+/*==================================================================================================
+                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+@brief      SysDal_Defer_Init - Empty all deferred work queues
+@details
+
+@return     none
+@retval     none
+
+@pre        No producer interrupt is enabled
+@post None
+*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_Defer_Init(void)
+{
+    SysDal_Defer_QueueIdType QueueId;
+
+    for (QueueId = 0U; QueueId < SYSDAL_DEFER_NUMBER_OF_QUEUES; QueueId++)
+    {
+        SysDal_Defer_Queue[QueueId].Head = 0U;
+        SysDal_Defer_Queue[QueueId].Tail = 0U;
+        SysDal_Defer_Queue[QueueId].OverflowCount = 0U;
+    }
+}
+
+/**
+@brief      SysDal_Defer_Post - Queue a work item for task context
+@details    Shall only be called by the single producer owning the queue, usually one interrupt
+            handler. The items of a queue are executed in the order they were posted.
+
+@param[in]  QueueId     Queue owned by the caller
+@param[in]  WorkFunc    Handler to be called in task context
+@param[in]  WorkArg     Argument passed to the handler
+
+@return     Std_ReturnType
+@retval     E_OK        Item queued
+@retval     E_NOT_OK    Queue full, the caller shall do the work itself or drop it
+
+@pre None
+@post None
+*/
+FUNC (Std_ReturnType, SAMPLE_APP_CODE) SysDal_Defer_Post(SysDal_Defer_QueueIdType QueueId, SysDal_Defer_WorkFuncType WorkFunc, uint32 WorkArg)
+{
+    Std_ReturnType RetVal = (Std_ReturnType)E_NOT_OK;
+    P2VAR(SysDal_Defer_QueueType, AUTOMATIC, SAMPLE_APP_VAR) pQueue = &SysDal_Defer_Queue[QueueId];
+    uint8 Head = pQueue->Head;
+
+    if ((uint8)(Head - pQueue->Tail) < (uint8)SYSDAL_DEFER_QUEUE_SIZE)
+    {
+        pQueue->Item[Head & SYSDAL_DEFER_QUEUE_MASK].WorkFunc = WorkFunc;
+        pQueue->Item[Head & SYSDAL_DEFER_QUEUE_MASK].WorkArg = WorkArg;
+        /* publish the item only after it is completely written */
+        pQueue->Head = (uint8)(Head + 1U);
+        RetVal = (Std_ReturnType)E_OK;
+    }
+    else
+    {
+        pQueue->OverflowCount++;
+    }
+    return RetVal;
+}
+
+/**
+@brief      SysDal_Defer_IsPending - Check for queued work
+@details
+
+@return     boolean
+@retval     TRUE    At least one work item is queued
+@retval     FALSE   All queues are empty
+
+@pre None
+@post None
+*/
+FUNC (boolean, SAMPLE_APP_CODE) SysDal_Defer_IsPending(void)
+{
+    boolean Pending = FALSE;
+    SysDal_Defer_QueueIdType QueueId;
+
+    for (QueueId = 0U; QueueId < SYSDAL_DEFER_NUMBER_OF_QUEUES; QueueId++)
+    {
+        if (SysDal_Defer_Queue[QueueId].Head != SysDal_Defer_Queue[QueueId].Tail)
+        {
+            Pending = TRUE;
+        }
+    }
+    return Pending;
+}
+
+/**
+@brief      SysDal_Defer_Process - Execute all queued work items
+@details    Shall be called from a single task context (the internal scheduler loop).
+            Queues are drained in queue id order, each one in posting order. Items posted while
+            draining are executed in the same call.
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_Defer_Process(void)
+{
+    SysDal_Defer_QueueIdType QueueId;
+    P2VAR(SysDal_Defer_QueueType, AUTOMATIC, SAMPLE_APP_VAR) pQueue;
+    SysDal_Defer_WorkFuncType WorkFunc;
+    uint32 WorkArg;
+    uint8 Tail;
+
+    for (QueueId = 0U; QueueId < SYSDAL_DEFER_NUMBER_OF_QUEUES; QueueId++)
+    {
+        pQueue = &SysDal_Defer_Queue[QueueId];
+        Tail = pQueue->Tail;
+        while (Tail != pQueue->Head)
+        {
+            WorkFunc = pQueue->Item[Tail & SYSDAL_DEFER_QUEUE_MASK].WorkFunc;
+            WorkArg = pQueue->Item[Tail & SYSDAL_DEFER_QUEUE_MASK].WorkArg;
+            /* release the slot before running the handler */
+            Tail++;
+            pQueue->Tail = Tail;
+            WorkFunc(WorkArg);
+        }
+    }
+}
+
+/*================================================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
@@ -37,7 +37,9 @@ extern "C"{
 ==================================================================================================*/
 #include "SysDal.h"
 #include "SysDal_IntSch.h"
+#include "SysDal_Defer.h"
 #include "Gpt.h"
+#include "Dem.h"
 #include "sys_init.h"
 
 /*===================================================================================================================
@@ -103,7 +105,27 @@ extern "C"{
 /*==================================================================================================
                                         LOCAL MACROS
 ==================================================================================================*/
+#if defined(AUTOSAR_OS_NOT_USED)
+#if (SYSDAL_INTSCH_NUMBER_OF_TASKS > 32U)
+    #error "SysDal_IntSch supports at most 32 tasks in the ready bitmap"
+#endif
+
+#if ((SYSDAL_INTSCH_TICKLESS_MODE == STD_ON) && (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_ON) && \
+     (GPT_CHANGE_NEXT_TIMEOUT_VALUE != STD_ON))
+    #error "SYSDAL_INTSCH_USE_CHANGE_TIMEOUT requires GPT_CHANGE_NEXT_TIMEOUT_VALUE"
+#endif
 
+#if ((SYSDAL_INTSCH_TICKLESS_MODE == STD_ON) && (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_OFF) && \
+     (GPT_TIME_ELAPSED_API != STD_ON))
+    #error "SYSDAL_INTSCH_TICKLESS_MODE without SYSDAL_INTSCH_USE_CHANGE_TIMEOUT requires GPT_TIME_ELAPSED_API"
+#endif
+
+#if defined(_LINARO_C_S32K14x_)
+    #define SYSDAL_INTSCH_CLZ(Value)        ((uint8)__builtin_clz(Value))
+#else
+    #define SYSDAL_INTSCH_CLZ(Value)        SysDal_IntSch_CountLeadingZeros(Value)
+#endif
+#endif
 
 /*==================================================================================================
                                       FILE VERSION CHECKS
@@ -124,58 +146,427 @@ extern "C"{
                                        LOCAL VARIABLES
 ==================================================================================================*/
 #if defined(AUTOSAR_OS_NOT_USED)
-
-#if (INTAPP_TASK_1_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task1_Time = 0U;
-volatile boolean SysDal_IntSch_Task1_isActive = FALSE;
+/* Current tick in the hyperperiod schedule table, only touched from the activation ISR */
+static uint16 SysDal_IntSch_TickIdx = 0U;
+
+/* One bit per ready task, set from the activation ISR and cleared by the dispatcher */
+static volatile uint32 SysDal_IntSch_ReadyMask = 0U;
+
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+/* Scheduler ticks covered by the GPT timeout that is currently running, 0 when it was shortened */
+static uint16 SysDal_IntSch_ProgrammedTicks = 1U;
+#if (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_ON)
+/* Scheduler ticks latched by the GPT driver for the timeout following the running one */
+static uint16 SysDal_IntSch_PendingTicks = 1U;
 #endif
-
-#if (INTAPP_TASK_2_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task2_Time = 0U;
-volatile boolean SysDal_IntSch_Task2_isActive = FALSE;
 #endif
 
-#if (INTAPP_TASK_3_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task3_Time = 0U;
-volatile boolean SysDal_IntSch_Task3_isActive = FALSE;
-#endif
+/* Task being executed by the dispatcher, 0 when idle */
+static volatile uint32 SysDal_IntSch_RunningMask = 0U;
 
-#if (INTAPP_TASK_4_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task4_Time = 0U;
-volatile boolean SysDal_IntSch_Task4_isActive = FALSE;
-#endif
+/* Activations queued behind the pending one (SYSDAL_INTSCH_POLICY_QUEUE) */
+static uint8 SysDal_IntSch_QueuedActivations[SYSDAL_INTSCH_NUMBER_OF_TASKS];
 
-#if (INTAPP_TASK_5_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task5_Time = 0U;
-volatile boolean SysDal_IntSch_Task5_isActive = FALSE;
-#endif
+/* Tasks whose next execution uses the degraded runnable (SYSDAL_INTSCH_POLICY_DEGRADE) */
+static uint32 SysDal_IntSch_DegradeMask = 0U;
 
-#if (INTAPP_TASK_6_ENABLE == STD_ON)    
-volatile uint16  SysDal_IntSch_Task6_Time = 0U;
-volatile boolean SysDal_IntSch_Task6_isActive = FALSE;
+#if (SYSDAL_FAST_BOOT == STD_ON)
+/* One bit per task whose boot stage has been reached, the other activations are dropped */
+static volatile uint32 SysDal_IntSch_BootMask = 0U;
 #endif
 
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+/* Cycle counter values of the activations waiting for the dispatcher, oldest one at StampHead */
+static uint32 SysDal_IntSch_ActivationStamp[SYSDAL_INTSCH_NUMBER_OF_TASKS][SYSDAL_INTSCH_MAX_QUEUE_LIMIT];
+static uint8 SysDal_IntSch_StampHead[SYSDAL_INTSCH_NUMBER_OF_TASKS];
+#endif
 #endif
 /*==================================================================================================
                                        GLOBAL CONSTANTS
 ==================================================================================================*/
-
+#if defined(AUTOSAR_OS_NOT_USED)
+extern const SysDal_IntSch_TaskConfigType SysDal_IntSch_TaskConfig[SYSDAL_INTSCH_NUMBER_OF_TASKS];
+extern const SysDal_IntSch_ScheduleEntryType SysDal_IntSch_ScheduleTable[SYSDAL_INTSCH_HYPERPERIOD];
+#endif
 /*==================================================================================================
                                        GLOBAL VARIABLES
 ==================================================================================================*/
-
-/**
-@brief This is the global variable that holds all the sample app specific data
-*/
+#if defined(AUTOSAR_OS_NOT_USED)
+SysDal_IntSch_DeadlineStatType SysDal_IntSch_DeadlineStat[SYSDAL_INTSCH_NUMBER_OF_TASKS];
+#endif
+#if defined(AUTOSAR_OS_NOT_USED) && (SYSDAL_INTSCH_STATISTICS == STD_ON)
+SysDal_IntSch_StatisticsType SysDal_IntSch_Statistics;
+#endif
 
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
 #if defined(AUTOSAR_OS_NOT_USED)
+#if !defined(_LINARO_C_S32K14x_)
+static FUNC (uint8, SAMPLE_APP_CODE) SysDal_IntSch_CountLeadingZeros(uint32 Value);
+#endif
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ProgramNextTimeout(uint16 Ticks);
+#endif
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ReportDeadlineMiss(uint32 WorkArg);
+static FUNC (uint32, SAMPLE_APP_CODE) SysDal_IntSch_CheckDeadlines(uint32 ReadyMask);
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_InitStatistics(void);
+static FUNC (uint8, SAMPLE_APP_CODE) SysDal_IntSch_GetHistogramBin(uint32 Cycles);
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_UpdateStatistics(uint8 TaskIdx, uint32 ActivationTime, uint32 StartTime, uint32 EndTime);
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_RecordActivations(uint32 ReadyMask);
+#endif
+
+/*==================================================================================================
+                                       LOCAL FUNCTIONS
+==================================================================================================*/
+#if !defined(_LINARO_C_S32K14x_)
+/**
+@brief      SysDal_IntSch_CountLeadingZeros - Portable count leading zeros
+@details    Used for the compilers without a CLZ intrinsic. Value shall not be 0.
+
+@return     Number of leading zero bits of Value
+@retval     0..31
+
+@pre None
+@post None
+*/
+static FUNC (uint8, SAMPLE_APP_CODE) SysDal_IntSch_CountLeadingZeros(uint32 Value)
+{
+    uint8 Count = 0U;
+
+    if (0U == (Value & 0xFFFF0000UL))
+    {
+        Count += 16U;
+        Value <<= 16U;
+    }
+    if (0U == (Value & 0xFF000000UL))
+    {
+        Count += 8U;
+        Value <<= 8U;
+    }
+    if (0U == (Value & 0xF0000000UL))
+    {
+        Count += 4U;
+        Value <<= 4U;
+    }
+    if (0U == (Value & 0xC0000000UL))
+    {
+        Count += 2U;
+        Value <<= 2U;
+    }
+    if (0U == (Value & 0x80000000UL))
+    {
+        Count += 1U;
+    }
+    return Count;
+}
+#endif
+
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+/**
+@brief      SysDal_IntSch_ProgramNextTimeout - Reprogram the scheduler GPT channel
+@details    Called from the activation ISR, right after the channel expired.
+            Channels supporting Gpt_ChangeNextTimeoutValue (FTM) have already latched the
+            timeout of the current cycle, so the new value applies to the cycle after it.
+            The other channels (LPIT) are restarted and the new value applies immediately. The
+            continuous channel reloaded and kept counting when it expired, the time it counted
+            since then (ISR entry and reprogramming latency) is removed from the new timeout so
+            the activations stay on the periodic tick grid.
+
+@param[in]  Ticks   Number of scheduler ticks of the reprogrammed timeout
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ProgramNextTimeout(uint16 Ticks)
+{
+    Gpt_ValueType Timeout = (Gpt_ValueType)Ticks * (Gpt_ValueType)GPT_SCH_TICKS;
+#if (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_OFF)
+    Gpt_ValueType Elapsed;
+#endif
+
+#if (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_ON)
+    Gpt_ChangeNextTimeoutValue(SYSDAL_SCH_GPT_TIMER_CHANNEL, Timeout);
+    SysDal_IntSch_PendingTicks = Ticks;
+#else
+    /* read as late as possible, only the stop/start sequence is left uncompensated */
+    Elapsed = Gpt_GetTimeElapsed(SYSDAL_SCH_GPT_TIMER_CHANNEL);
+    Timeout = (Elapsed < Timeout) ? (Timeout - Elapsed) : 1U;
+    Gpt_StopTimer(SYSDAL_SCH_GPT_TIMER_CHANNEL);
+    Gpt_StartTimer(SYSDAL_SCH_GPT_TIMER_CHANNEL, Timeout);
+    /* the channel reloads the shortened timeout on each expiry, the next expiry reprograms
+       the full one */
+    SysDal_IntSch_ProgrammedTicks = (0U == Elapsed) ? Ticks : 0U;
+#endif
+}
+#endif
+
+/**
+@brief      SysDal_IntSch_ReportDeadlineMiss - Report a deadline miss to Dem
+@details    Deferred work of the activation ISR, posted on SYSDAL_DEFER_QUEUE_INTSCH.
+
+@param[in]  WorkArg     Index of the task that missed its deadline
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ReportDeadlineMiss(uint32 WorkArg)
+{
+    Dem_ReportErrorStatus(SysDal_IntSch_TaskConfig[WorkArg].DemEventId, DEM_EVENT_STATUS_FAILED);
+}
+
+/**
+@brief      SysDal_IntSch_CheckDeadlines - Apply the deadline policies to the activations of a tick
+@details    Called from the activation ISR. An activation of a task still pending or running is
+            a deadline miss: it is counted, reported to Dem in task context and handled by the
+            task policy.
+            SKIP drops it, QUEUE keeps it while fewer than QueueLimit activations are waiting,
+            DEGRADE merges it with the waiting one, which then runs the degraded runnable.
+
+@param[in]  ReadyMask   Tasks activated on the current tick
+
+@return     Activations to be set in the ready bitmap
+
+@pre None
+@post None
+*/
+static FUNC (uint32, SAMPLE_APP_CODE) SysDal_IntSch_CheckDeadlines(uint32 ReadyMask)
+{
+    uint32 MissMask = ReadyMask & (SysDal_IntSch_ReadyMask | SysDal_IntSch_RunningMask);
+    uint32 TaskMask;
+    uint8  TaskIdx;
+    uint8  Waiting;
+    boolean Accepted;
+    P2CONST(SysDal_IntSch_TaskConfigType, AUTOMATIC, SAMPLE_APP_CONST) pTask;
+
+    while (0U != MissMask)
+    {
+        TaskIdx = SYSDAL_INTSCH_CLZ(MissMask);
+        TaskMask = SYSDAL_INTSCH_TASK_MASK(TaskIdx);
+        MissMask &= ~TaskMask;
+        pTask = &SysDal_IntSch_TaskConfig[TaskIdx];
+
+        SysDal_IntSch_DeadlineStat[TaskIdx].MissCount++;
+        if (0U != pTask->DemEventId)
+        {
+            /* the Dem report is not time critical, it runs before the next dispatch */
+            if ((Std_ReturnType)E_OK != SysDal_Defer_Post(SYSDAL_DEFER_QUEUE_INTSCH, &SysDal_IntSch_ReportDeadlineMiss, (uint32)TaskIdx))
+            {
+                SysDal_IntSch_ReportDeadlineMiss((uint32)TaskIdx);
+            }
+        }
+
+        /* activations waiting for the dispatcher, the pending one included */
+        Waiting = SysDal_IntSch_QueuedActivations[TaskIdx];
+        if (0U != (SysDal_IntSch_ReadyMask & TaskMask))
+        {
+            Waiting++;
+        }
+
+        Accepted = FALSE;
+        switch (pTask->DeadlinePolicy)
+        {
+            case SYSDAL_INTSCH_POLICY_QUEUE:
+            {
+                if (Waiting < pTask->QueueLimit)
+                {
+                    if (0U != Waiting)
+                    {
+                        SysDal_IntSch_QueuedActivations[TaskIdx]++;
+                    }
+                    Accepted = TRUE;
+                }
+            }break;
+
+            case SYSDAL_INTSCH_POLICY_DEGRADE:
+            {
+                SysDal_IntSch_DegradeMask |= TaskMask;
+                /* only running: the new activation is the one to degrade */
+                Accepted = (0U == Waiting) ? TRUE : FALSE;
+            }break;
+
+            default:
+            {
+                /* SYSDAL_INTSCH_POLICY_SKIP */
+            }break;
+        }
+
+        if (FALSE == Accepted)
+        {
+            SysDal_IntSch_DeadlineStat[TaskIdx].DropCount++;
+            ReadyMask &= ~TaskMask;
+        }
+    }
+    return ReadyMask;
+}
+
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
 /**
-@brief      SysDal_IntSch_StopScheduler - Start Internal scheduler
+@brief      SysDal_IntSch_InitStatistics - Reset the task statistics table
+@details    Enables the DWT cycle counter and clears the statistics of all tasks.
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_InitStatistics(void)
+{
+    uint8 TaskIdx;
+    uint8 BinIdx;
+    P2VAR(SysDal_IntSch_TaskStatType, AUTOMATIC, SAMPLE_APP_VAR) pTaskStat;
+
+    SysDal_EnableCycleCounter();
+
+    SysDal_IntSch_Statistics.Magic = SYSDAL_INTSCH_STAT_MAGIC;
+    SysDal_IntSch_Statistics.NumberOfTasks = (uint16)SYSDAL_INTSCH_NUMBER_OF_TASKS;
+    SysDal_IntSch_Statistics.HistogramBins = (uint8)SYSDAL_INTSCH_STAT_HISTOGRAM_BINS;
+    SysDal_IntSch_Statistics.HistogramShift = (uint8)SYSDAL_INTSCH_STAT_HISTOGRAM_SHIFT;
+
+    for (TaskIdx = 0U; TaskIdx < SYSDAL_INTSCH_NUMBER_OF_TASKS; TaskIdx++)
+    {
+        pTaskStat = &SysDal_IntSch_Statistics.Task[TaskIdx];
+        pTaskStat->ExecTimeSum = 0U;
+        pTaskStat->LatencySum = 0U;
+        pTaskStat->ExecCount = 0U;
+        pTaskStat->ExecTimeMin = 0xFFFFFFFFUL;
+        pTaskStat->ExecTimeMax = 0U;
+        pTaskStat->LatencyMin = 0xFFFFFFFFUL;
+        pTaskStat->LatencyMax = 0U;
+        for (BinIdx = 0U; BinIdx < SYSDAL_INTSCH_STAT_HISTOGRAM_BINS; BinIdx++)
+        {
+            pTaskStat->ExecTimeHistogram[BinIdx] = 0U;
+            pTaskStat->LatencyHistogram[BinIdx] = 0U;
+        }
+    }
+}
+
+/**
+@brief      SysDal_IntSch_GetHistogramBin - Histogram bin of a cycle count
 @details    
 
+@return     Bin index, values beyond the histogram range go to the last bin
+@retval     0..SYSDAL_INTSCH_STAT_HISTOGRAM_BINS-1
+
+@pre None
+@post None
+*/
+static FUNC (uint8, SAMPLE_APP_CODE) SysDal_IntSch_GetHistogramBin(uint32 Cycles)
+{
+    uint32 BinIdx = Cycles >> SYSDAL_INTSCH_STAT_HISTOGRAM_SHIFT;
+
+    if (BinIdx >= SYSDAL_INTSCH_STAT_HISTOGRAM_BINS)
+    {
+        BinIdx = SYSDAL_INTSCH_STAT_HISTOGRAM_BINS - 1U;
+    }
+    return (uint8)BinIdx;
+}
+
+/**
+@brief      SysDal_IntSch_UpdateStatistics - Account one task execution
+@details    Called by the dispatcher after the task returned. Only the dispatcher writes these
+            fields.
+
+@param[in]  TaskIdx         Index of the executed task
+@param[in]  ActivationTime  Cycle counter value when the dispatched activation was raised
+@param[in]  StartTime       Cycle counter value when the task was started
+@param[in]  EndTime         Cycle counter value when the task returned
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_UpdateStatistics(uint8 TaskIdx, uint32 ActivationTime, uint32 StartTime, uint32 EndTime)
+{
+    P2VAR(SysDal_IntSch_TaskStatType, AUTOMATIC, SAMPLE_APP_VAR) pTaskStat = &SysDal_IntSch_Statistics.Task[TaskIdx];
+    uint32 ExecTime = EndTime - StartTime;
+    uint32 Latency = StartTime - ActivationTime;
+
+    pTaskStat->ExecCount++;
+    pTaskStat->ExecTimeSum += ExecTime;
+    pTaskStat->LatencySum += Latency;
+    if (ExecTime < pTaskStat->ExecTimeMin)
+    {
+        pTaskStat->ExecTimeMin = ExecTime;
+    }
+    if (ExecTime > pTaskStat->ExecTimeMax)
+    {
+        pTaskStat->ExecTimeMax = ExecTime;
+    }
+    if (Latency < pTaskStat->LatencyMin)
+    {
+        pTaskStat->LatencyMin = Latency;
+    }
+    if (Latency > pTaskStat->LatencyMax)
+    {
+        pTaskStat->LatencyMax = Latency;
+    }
+    pTaskStat->ExecTimeHistogram[SysDal_IntSch_GetHistogramBin(ExecTime)]++;
+    pTaskStat->LatencyHistogram[SysDal_IntSch_GetHistogramBin(Latency)]++;
+}
+
+/**
+@brief      SysDal_IntSch_RecordActivations - Account the activations of one tick
+@details    Called from the activation ISR with the activations accepted by the deadline policies.
+            A task becoming ready restarts its timestamp queue, an activation queued behind the
+            pending one (SYSDAL_INTSCH_POLICY_QUEUE) gets the next entry, behind the stamps of
+            the activations still waiting.
+
+@param[in]  ReadyMask   Tasks activated on the current tick
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+static FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_RecordActivations(uint32 ReadyMask)
+{
+    uint32 Now = SysDal_GetCycleCount();
+    uint32 PendingMask = SysDal_IntSch_ReadyMask;
+    uint8  TaskIdx;
+    uint8  StampIdx;
+
+    while (0U != ReadyMask)
+    {
+        TaskIdx = SYSDAL_INTSCH_CLZ(ReadyMask);
+        ReadyMask &= ~SYSDAL_INTSCH_TASK_MASK(TaskIdx);
+        if (0U != (PendingMask & SYSDAL_INTSCH_TASK_MASK(TaskIdx)))
+        {
+            /* queued behind the pending activation, already counted by SysDal_IntSch_CheckDeadlines */
+            StampIdx = SysDal_IntSch_StampHead[TaskIdx] + SysDal_IntSch_QueuedActivations[TaskIdx];
+            if (StampIdx >= SYSDAL_INTSCH_MAX_QUEUE_LIMIT)
+            {
+                StampIdx -= SYSDAL_INTSCH_MAX_QUEUE_LIMIT;
+            }
+            SysDal_IntSch_ActivationStamp[TaskIdx][StampIdx] = Now;
+        }
+        else
+        {
+            SysDal_IntSch_StampHead[TaskIdx] = 0U;
+            SysDal_IntSch_ActivationStamp[TaskIdx][0U] = Now;
+        }
+    }
+}
+#endif
+
+/*==================================================================================================
+                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+@brief      SysDal_IntSch_StartScheduler - Start Internal scheduler
+@details    Clears the task statistics and starts the schedule table.
+
 @return     none
 @retval     none
 
@@ -184,6 +575,44 @@ volatile boolean SysDal_IntSch_Task6_isActive = FALSE;
 */
 FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_StartScheduler(void)
 {
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+    SysDal_IntSch_InitStatistics();
+#endif
+    SysDal_IntSch_ResumeScheduler();
+}
+
+
+/**
+@brief      SysDal_IntSch_ResumeScheduler - Restart Internal scheduler after a stop
+@details    Drops the activations still pending from before the stop, restarts the schedule
+            table from the beginning of the hyperperiod and starts the scheduler GPT channel.
+            The task statistics are kept.
+
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_ResumeScheduler(void)
+{
+    uint8 TaskIdx;
+
+    SysDal_IntSch_ReadyMask = 0U;
+    SysDal_IntSch_DegradeMask = 0U;
+    for (TaskIdx = 0U; TaskIdx < SYSDAL_INTSCH_NUMBER_OF_TASKS; TaskIdx++)
+    {
+        SysDal_IntSch_QueuedActivations[TaskIdx] = 0U;
+    }
+    /* the first interrupt is raised on tick 1 of the hyperperiod */
+    SysDal_IntSch_TickIdx = 1U % SYSDAL_INTSCH_HYPERPERIOD;
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+    /* first interrupt after one tick, the ISR programs the following timeouts from the table */
+    SysDal_IntSch_ProgrammedTicks = 1U;
+#if (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_ON)
+    SysDal_IntSch_PendingTicks = 1U;
+#endif
+#endif
     Gpt_EnableNotification(SYSDAL_SCH_GPT_TIMER_CHANNEL);
     Gpt_StartTimer(SYSDAL_SCH_GPT_TIMER_CHANNEL, GPT_SCH_TICKS);
 }
@@ -206,9 +635,11 @@ FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_StopScheduler(void)
 }
 
 
+#if (SYSDAL_FAST_BOOT == STD_ON)
 /**
-@brief      SysDal_IntSch_TaskActivationIsr - Interrupt handler for round-robin scheduler
-@details    
+@brief      SysDal_IntSch_SetBootStage - Enable the tasks of a boot stage
+@details    Called by SysDal on each boot stage change. The tasks configured for the given
+            stage or an earlier one are activated from now on.
 
 @return     none
 @retval     none
@@ -216,161 +647,214 @@ FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_StopScheduler(void)
 @pre None
 @post None
 */
-FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_TaskActivationIsr(void)
+FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_SetBootStage(SysDal_BootStageType Stage)
 {
-    /* Setup all the needed interrupts(and their priorities) */
-    sys_disableAllInterrupts();
+    uint8  TaskIdx;
+    uint32 BootMask = 0U;
 
-#if (INTAPP_TASK_1_ENABLE == STD_ON)    
-    SysDal_IntSch_Task1_Time++;
+    for (TaskIdx = 0U; TaskIdx < SYSDAL_INTSCH_NUMBER_OF_TASKS; TaskIdx++)
+    {
+        if (SysDal_IntSch_TaskConfig[TaskIdx].BootStage <= Stage)
+        {
+            BootMask |= SYSDAL_INTSCH_TASK_MASK(TaskIdx);
+        }
+    }
+    SysDal_IntSch_BootMask = BootMask;
+}
 #endif
 
-#if (INTAPP_TASK_2_ENABLE == STD_ON)    
-    SysDal_IntSch_Task2_Time++;
-#endif
 
-#if (INTAPP_TASK_3_ENABLE == STD_ON)    
-    SysDal_IntSch_Task3_Time++;     
-#endif
+/**
+@brief      SysDal_IntSch_TaskActivationIsr - Interrupt handler for the priority scheduler
+@details    Looks up the ready mask of the current tick in the generated schedule table and
+            ORs it into the ready bitmap, after the deadline policies of the tasks still pending
+            or running have been applied.
+            In tickless mode the GPT channel is reprogrammed with the distance to the next
+            tick activating a task, as stored in the table, so no interrupt is taken on
+            ticks where no task becomes ready.
 
-#if (INTAPP_TASK_4_ENABLE == STD_ON)    
-    SysDal_IntSch_Task4_Time++;
+@return     none
+@retval     none
+
+@pre None
+@post None
+*/
+FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_TaskActivationIsr(void)
+{
+    uint32 ReadyMask = SysDal_IntSch_ScheduleTable[SysDal_IntSch_TickIdx].ReadyMask;
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+    uint16 Ticks;
 #endif
 
-#if (INTAPP_TASK_5_ENABLE == STD_ON)    
-    SysDal_IntSch_Task5_Time++;
+#if (SYSDAL_FAST_BOOT == STD_ON)
+    ReadyMask &= SysDal_IntSch_BootMask;
 #endif
 
-#if (INTAPP_TASK_6_ENABLE == STD_ON)    
-    SysDal_IntSch_Task6_Time++;     
-#endif     
-  
-#if (INTAPP_TASK_1_ENABLE == STD_ON)      
-    if (SysDal_IntSch_Task1_Time >= INTAPP_TASK_1_ACTIVATION_TIME)
+    if (0U != ReadyMask)
     {
-       SysDal_IntSch_Task1_Time = 0U;       
-       SysDal_IntSch_Task1_isActive = TRUE;
+        ReadyMask = SysDal_IntSch_CheckDeadlines(ReadyMask);
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+        SysDal_IntSch_RecordActivations(ReadyMask);
+#endif
     }
-#endif 
 
-#if (INTAPP_TASK_2_ENABLE == STD_ON)     
-    if (SysDal_IntSch_Task2_Time >= INTAPP_TASK_2_ACTIVATION_TIME)
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+#if (SYSDAL_INTSCH_USE_CHANGE_TIMEOUT == STD_ON)
+    /* the cycle starting now is already latched, plan the one after it */
+    Ticks = SysDal_IntSch_PendingTicks;
+    SysDal_IntSch_TickIdx += Ticks;
+    if (SysDal_IntSch_TickIdx >= SYSDAL_INTSCH_HYPERPERIOD)
     {
-       SysDal_IntSch_Task2_Time = 0U;       
-       SysDal_IntSch_Task2_isActive = TRUE;
+        SysDal_IntSch_TickIdx -= SYSDAL_INTSCH_HYPERPERIOD;
     }
-#endif 
-
-#if (INTAPP_TASK_3_ENABLE == STD_ON)    
-    if (SysDal_IntSch_Task3_Time >= INTAPP_TASK_3_ACTIVATION_TIME)
+    if (SysDal_IntSch_ScheduleTable[SysDal_IntSch_TickIdx].NextTicks != Ticks)
     {
-        SysDal_IntSch_Task3_Time = 0U;       
-        SysDal_IntSch_Task3_isActive = TRUE;
+        SysDal_IntSch_ProgramNextTimeout(SysDal_IntSch_ScheduleTable[SysDal_IntSch_TickIdx].NextTicks);
     }
-#endif 
-
-#if (INTAPP_TASK_4_ENABLE == STD_ON)   
-    if (SysDal_IntSch_Task4_Time >= INTAPP_TASK_4_ACTIVATION_TIME)
+#else
+    Ticks = SysDal_IntSch_ScheduleTable[SysDal_IntSch_TickIdx].NextTicks;
+    if (Ticks != SysDal_IntSch_ProgrammedTicks)
     {
-        SysDal_IntSch_Task4_Time = 0U;       
-        SysDal_IntSch_Task4_isActive = TRUE;
+        SysDal_IntSch_ProgramNextTimeout(Ticks);
     }
-#endif 
-
-#if (INTAPP_TASK_5_ENABLE == STD_ON)    
-    if (SysDal_IntSch_Task5_Time >= INTAPP_TASK_5_ACTIVATION_TIME)
+    SysDal_IntSch_TickIdx += Ticks;
+    if (SysDal_IntSch_TickIdx >= SYSDAL_INTSCH_HYPERPERIOD)
+    {
+        SysDal_IntSch_TickIdx -= SYSDAL_INTSCH_HYPERPERIOD;
+    }
+#endif
+#else
+    SysDal_IntSch_TickIdx++;
+    if (SysDal_IntSch_TickIdx >= SYSDAL_INTSCH_HYPERPERIOD)
     {
-        SysDal_IntSch_Task5_Time = 0U;       
-        SysDal_IntSch_Task5_isActive = TRUE;
+        SysDal_IntSch_TickIdx = 0U;
     }
-#endif 
+#endif
 
-#if (INTAPP_TASK_6_ENABLE == STD_ON)   
-    if (SysDal_IntSch_Task6_Time >= INTAPP_TASK_6_ACTIVATION_TIME)
+    if (0U != ReadyMask)
     {
-        SysDal_IntSch_Task6_Time = 0U;       
-        SysDal_IntSch_Task6_isActive = TRUE;
+        sys_disableAllInterrupts();
+        SysDal_IntSch_ReadyMask |= ReadyMask;
+        sys_enableAllInterrupts();
     }
-#endif   
-    
-    /* Enable external Interrupts */
-    sys_enableAllInterrupts();
 }
 
 
 
 /**
-@brief      SysDal_IntSch_TaskScheduler - Interal round-robin scheduler
-@details    
+@brief      SysDal_IntSch_TaskScheduler - Internal priority scheduler
+@details    Dispatches the highest priority ready task. The lookup is a single count leading
+            zeros on the ready bitmap, independent of the number of configured tasks.
+            The deferred work queues are drained before each dispatch.
+            Queued and degraded activations are resolved here, see SysDal_IntSch_CheckDeadlines.
+            The first dispatch after start-up or resume closes the SysDal latency measurement.
+            With fast boot the background init steps are run when no task is ready.
+            A sleep request of SysDal_MainFunction is served when no task is ready, after the
+            requesting task has returned.
+            In tickless mode the core waits for the next interrupt (WFI) when no task is ready.
+            The ready check and the WFI run with interrupts masked, so an activation raised
+            in between still wakes the core up.
 
-@return     Returns the value of success
-@retval     E_OK or E_NOT_OK
+@return     none
+@retval     none
 
 @pre None
 @post None
 */
 FUNC (void, SAMPLE_APP_CODE) SysDal_IntSch_TaskScheduler(void)
 {
-    /* local variables here */
+    uint32 ReadyMask;
+    uint32 TaskMask;
+    uint8  TaskIdx;
+    SysDal_CalloutType TaskRunnable;
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+    uint32 ActivationTime;
+    uint32 StartTime;
+#endif
+
     INTAPP_PREHOOK_TASK();
     
     while (1)
     {
+        /* work deferred by the interrupt handlers runs before any task */
+        SysDal_Defer_Process();
 
-#if (INTAPP_TASK_1_ENABLE == STD_ON) /**/
-        if (TRUE == SysDal_IntSch_Task1_isActive)
+        ReadyMask = SysDal_IntSch_ReadyMask;
+        if (0U != ReadyMask)
         {
-            SysDal_IntSch_Task1_isActive = FALSE;  
-            /* call Task 1 */
-            INTAPP_TASK_1();
-        }
-#endif 
+            TaskIdx = SYSDAL_INTSCH_CLZ(ReadyMask);
+            TaskMask = SYSDAL_INTSCH_TASK_MASK(TaskIdx);
+            TaskRunnable = SysDal_IntSch_TaskConfig[TaskIdx].TaskRunnable;
 
-#if (INTAPP_TASK_2_ENABLE == STD_ON)  
-        if (TRUE == SysDal_IntSch_Task2_isActive)
-        {
-            SysDal_IntSch_Task2_isActive = FALSE;  
-            /* call Task 2 */
-            INTAPP_TASK_2();
-        }
-#endif      
-     
-#if (INTAPP_TASK_3_ENABLE == STD_ON)      
-        if (TRUE == SysDal_IntSch_Task3_isActive)
-        {
-            SysDal_IntSch_Task3_isActive = FALSE;  
-            /* call Task 3 */
-            INTAPP_TASK_3();
+            sys_disableAllInterrupts();
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+            ActivationTime = SysDal_IntSch_ActivationStamp[TaskIdx][SysDal_IntSch_StampHead[TaskIdx]];
+#endif
+            if (0U != SysDal_IntSch_QueuedActivations[TaskIdx])
+            {
+                /* a queued activation keeps the task ready */
+                SysDal_IntSch_QueuedActivations[TaskIdx]--;
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+                SysDal_IntSch_StampHead[TaskIdx]++;
+                if (SysDal_IntSch_StampHead[TaskIdx] >= SYSDAL_INTSCH_MAX_QUEUE_LIMIT)
+                {
+                    SysDal_IntSch_StampHead[TaskIdx] = 0U;
+                }
+#endif
+            }
+            else
+            {
+                SysDal_IntSch_ReadyMask &= ~TaskMask;
+            }
+            if (0U != (SysDal_IntSch_DegradeMask & TaskMask))
+            {
+                SysDal_IntSch_DegradeMask &= ~TaskMask;
+                if (NULL_PTR != SysDal_IntSch_TaskConfig[TaskIdx].DegradedRunnable)
+                {
+                    TaskRunnable = SysDal_IntSch_TaskConfig[TaskIdx].DegradedRunnable;
+                }
+            }
+            SysDal_IntSch_RunningMask = TaskMask;
+            sys_enableAllInterrupts();
+
+#if (SYSDAL_WAKEUP_LATENCY == STD_ON)
+            if (SYSDAL_LATENCY_IDLE != SysDal_LatencyMeasurement)
+            {
+                SysDal_RecordFirstTaskLatency();
+            }
+#endif
+#if (SYSDAL_INTSCH_STATISTICS == STD_ON)
+            StartTime = SysDal_GetCycleCount();
+            TaskRunnable();
+            SysDal_IntSch_UpdateStatistics(TaskIdx, ActivationTime, StartTime, SysDal_GetCycleCount());
+#else
+            TaskRunnable();
+#endif
+            SysDal_IntSch_RunningMask = 0U;
         }
-#endif 
-
-
-#if (INTAPP_TASK_4_ENABLE == STD_ON) 
-        if (TRUE == SysDal_IntSch_Task4_isActive)
+#if (SYSDAL_FAST_BOOT == STD_ON)
+        else if (TRUE == SysDal_RunBootStep())
         {
-            SysDal_IntSch_Task4_isActive = FALSE;  
-            /* call Task 4 */
-            INTAPP_TASK_4();
+            /* background driver init runs in idle time only */
         }
-#endif 
-
-#if (INTAPP_TASK_5_ENABLE == STD_ON)  
-        if (TRUE == SysDal_IntSch_Task5_isActive)
+#endif
+#if (SYSDAL_LOW_POWER_MODE == STD_ON)
+        else if (TRUE == SysDal_EnterSleepMode())
         {
-            SysDal_IntSch_Task5_isActive = FALSE;  
-            /* call Task 5 */
-            INTAPP_TASK_5();
+            /* back from the sleep mode, the scheduler has been resumed */
         }
-#endif      
-     
-#if (INTAPP_TASK_6_ENABLE == STD_ON)      
-        if (TRUE == SysDal_IntSch_Task6_isActive)
+#endif
+#if (SYSDAL_INTSCH_TICKLESS_MODE == STD_ON)
+        else
         {
-            SysDal_IntSch_Task6_isActive = FALSE;  
-            /* call Task 6 */
-            INTAPP_TASK_6();
+            sys_disableAllInterrupts();
+            if ((0U == SysDal_IntSch_ReadyMask) && (FALSE == SysDal_Defer_IsPending()))
+            {
+                sys_halt();
+            }
+            sys_enableAllInterrupts();
         }
-#endif         
+#endif
     }
 }
 #endif
@@ -191,18 +191,28 @@ void SwcActuators_Init( const SwcRte_GlobalConfigType * ConfigPtr )
 /*================================================================================================*/
 void SwcActuators_MainRunnable()
 {
-    SwcRte_AppChannelIdType AppChannelId;
     SwcRte_AppInstanceIdType RteAppInstance;
-    SwcRte_OutputValueType OutputValue;
 
-#if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)    
+#if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON) && (SWCRTE_GENERATED_PORTS == SWCRTE_STD_OFF)
+    SwcRte_AppChannelIdType AppChannelId;
+    SwcRte_OutputValueType OutputValue;
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    const AppLightingActuatorValueType * pLightingOutputValue;
+#else
     AppLightingActuatorValueType  LightingOutputValue;
+    const AppLightingActuatorValueType * pLightingOutputValue = &LightingOutputValue;
+#endif
 #endif
 #if (SWCRTE_MOTORCTRL_APP_ENABLED == SWCRTE_STD_ON)    
     AppMotorCtrlActuatorValueType  MotorCtrlOutputValue;
 #endif    
     SwcRte_AppInstanceType   AppType;
 
+#if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON) && (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+    /*the published requests of all lighting instances, written through the generated ports*/
+    SwcRte_WriteActuatorPorts();
+#endif
+
     for (RteAppInstance = 0; RteAppInstance < SWCRTE_MAX_APP_INSTANCES; RteAppInstance++)
     {
         /*get the sensor channel id base on type of channel  */
@@ -211,16 +221,20 @@ void SwcActuators_MainRunnable()
         /*process values differently depending on their type*/
         switch (AppType)
         {
-#if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)    
+#if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON) && (SWCRTE_GENERATED_PORTS == SWCRTE_STD_OFF)
             case SWCRTE_LIGHTING:
             {
                 /*read output info associated to that current instance*/
+            #if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+                pLightingOutputValue = SwcRte_GetLightingOutputRequest(RteAppInstance);
+            #else
                 SwcRte_ReadLightingOutputRequest(RteAppInstance,  &LightingOutputValue);
+            #endif
 
                 /*for all available inputs */
                 for (AppChannelId = 0; AppChannelId < SwcActuators_ConfigPtr[RteAppInstance].u8NoOutputChannel; AppChannelId++)
                 {
-                    OutputValue = LightingOutputValue.aLightingOutputIntesity[AppChannelId];
+                    OutputValue = pLightingOutputValue->aLightingOutputIntesity[AppChannelId];
                     
                     SwcRte_WriteOutputs(RteAppInstance, AppChannelId,  OutputValue);
                 }
@@ -242,6 +256,9 @@ void SwcActuators_MainRunnable()
             break;                
         }
     }
+
+    /*drive the outputs written by all instances together*/
+    SwcRte_FlushOutputs();
 }
 
 
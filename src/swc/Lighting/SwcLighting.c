@@ -114,13 +114,24 @@ extern "C"{
 #define SWCLIGHTING_SECOND_BUTTON_PRESS      (2U)
 #define SWCLIGHTING_MAX_DIMMING_INCREMENT    (8U)
 #define SWCLIGHTING_PWM_MAX_DUTY_CYCLE       (0x8000U) 
-#define SWCLIGHTING_AVG_SUM_COUNT             4U
-#define SWCLIGHTING_AVG_DENOMINATOR_SHIFT     2U
 #define SWCLIGHTING_MAX_TRANSIENT_ERR_COUNT   2U
-#define SWCLIGHTING_MAX_FBK_ERR_VALUE         100U
+#define SWCLIGHTING_MAX_FBK_ERR_VALUE         400U
+#if (SWCLIGHTING_GAMMA_CORRECTION == SWCRTE_STD_ON)
+/*brightness steps between two points of SwcRte_LightingGammaLutPB*/
+#define SWCLIGHTING_GAMMA_SEGMENT_SHIFT       11U
+#endif
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+/*fractional bits of SwcLighting_FadeLevel*/
+#define SWCLIGHTING_FADE_FRACTION_BITS        8U
+#endif
 /*==================================================================================================
                                       FILE VERSION CHECKS
 ==================================================================================================*/
+#if (SWCLIGHTING_GAMMA_CORRECTION == SWCRTE_STD_ON)
+#if (((SWCLIGHTING_PWM_MAX_DUTY_CYCLE >> SWCLIGHTING_GAMMA_SEGMENT_SHIFT) + 1U) != SWCLIGHTING_GAMMA_LUT_POINTS)
+    #error "SwcRte_LightingGammaLutPB shall have one point every (1 << SWCLIGHTING_GAMMA_SEGMENT_SHIFT) brightness steps up to SWCLIGHTING_PWM_MAX_DUTY_CYCLE"
+#endif
+#endif
 
 
 /*==================================================================================================
@@ -145,11 +156,16 @@ static const SwcRte_GlobalConfigType * SwcLighting_ConfigPtr;
 /*==================================================================================================
                                        GLOBAL VARIABLES
 ==================================================================================================*/
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_OFF)
 /*Global variable holding Lighting Actuator Data*/
 AppLightingActuatorValueType    SwcRte_aLightingActuatorData[SWCRTE_MAX_LIGHTING_INSTANCES];
 
 /*Global variable holding Lighting Sensor Data*/
 AppLightingSensorValueType      SwcRte_aLightingSensorData[SWCRTE_MAX_LIGHTING_INSTANCES];
+#else
+/*sequence of the last sensor data processed, the sensor port is read only*/
+static uint8_t                  SwcLighting_SensorSequence[SWCRTE_MAX_LIGHTING_INSTANCES];
+#endif
 
 
 #if (SWCRTE_VDR_APP_ENABLED == SWCRTE_STD_ON)
@@ -169,20 +185,138 @@ static SwcRte_InstanceStateType SwcLightning_InstanceState[SWCRTE_MAX_LIGHTING_I
 static SwcRte_InputStateType    SwcLighting_PreviosButtonState[SWCRTE_MAX_LIGHTING_INSTANCES];
 static SwcRte_InputStateType    SwcLighting_ButtonState[SWCRTE_MAX_LIGHTING_INSTANCES];
 static uint16_t                 SwcLighting_OutputValue[SWCRTE_MAX_LIGHTING_INSTANCES];
-static uint32_t                 SwcLighting_SumFeedbackValue[SWCRTE_MAX_LIGHTING_INSTANCES][SWCRTE_MAX_LIGHTING_CHANNELS];
-static uint8_t                  SwcLighting_AvgValueCounter[SWCRTE_MAX_LIGHTING_INSTANCES][SWCRTE_MAX_LIGHTING_CHANNELS];
-static uint16_t                 SwcLighting_AvgFeedbackValue[SWCRTE_MAX_LIGHTING_INSTANCES][SWCRTE_MAX_LIGHTING_CHANNELS];
+static uint16_t                 SwcLighting_LastFeedbackValue[SWCRTE_MAX_LIGHTING_INSTANCES][SWCRTE_MAX_LIGHTING_CHANNELS];
 static uint8_t                  SwcLighting_CountTransientError[SWCRTE_MAX_LIGHTING_INSTANCES][SWCRTE_MAX_LIGHTING_CHANNELS];
 static uint8_t                  SwcLighting_CountButtonPressed[SWCRTE_MAX_LIGHTING_INSTANCES];
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+/*brightness of the PWM outputs while fading, SWCLIGHTING_FADE_FRACTION_BITS fractional bits*/
+static int32_t                  SwcLighting_FadeLevel[SWCRTE_MAX_LIGHTING_INSTANCES];
+/*brightness added to SwcLighting_FadeLevel on each run*/
+static int32_t                  SwcLighting_FadeStep[SWCRTE_MAX_LIGHTING_INSTANCES];
+/*runs left until SwcLighting_OutputValue is reached, 0 when no fade is in progress*/
+static uint8_t                  SwcLighting_FadeTicksLeft[SWCRTE_MAX_LIGHTING_INSTANCES];
+/*SwcLighting_OutputValue the last fade was started towards*/
+static uint16_t                 SwcLighting_FadeTarget[SWCRTE_MAX_LIGHTING_INSTANCES];
+#endif
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
 static void SwcLighting_CalculateOuputValue(SwcRte_AppInstanceIdType RteAppInstance);
 static void SwcLighting_ProcessFeedback(SwcRte_AppInstanceIdType RteAppInstance);
+static uint16_t SwcLighting_DimmingCurve(uint16_t Brightness);
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+static void SwcLighting_FadeOutputs(SwcRte_AppInstanceIdType RteAppInstance);
+#endif
 /*==================================================================================================
                                        LOCAL FUNCTIONS
 ==================================================================================================*/
 
+/*================================================================================================*/
+/**
+@brief      SwcLighting_DimmingCurve - converts a brightness to a PWM duty cycle
+@details    The brightness is mapped through the SwcRte_LightingGammaLutPB points, values between two
+            points are linearly interpolated. Without SWCLIGHTING_GAMMA_CORRECTION the duty cycle is
+            the brightness.
+
+@param[in]  Brightness    Brightness, 0 to SWCLIGHTING_PWM_MAX_DUTY_CYCLE.
+
+@return     PWM duty cycle, 0 to SWCLIGHTING_PWM_MAX_DUTY_CYCLE
+
+@pre None
+@post None
+*/
+/*================================================================================================*/
+static uint16_t SwcLighting_DimmingCurve(uint16_t Brightness)
+{
+#if (SWCLIGHTING_GAMMA_CORRECTION == SWCRTE_STD_ON)
+    uint32_t Segment = (uint32_t)Brightness >> SWCLIGHTING_GAMMA_SEGMENT_SHIFT;
+    uint32_t Fraction = (uint32_t)Brightness & ((1UL << SWCLIGHTING_GAMMA_SEGMENT_SHIFT) - 1UL);
+    uint32_t Low;
+    uint32_t High;
+    uint16_t DutyCycle;
+
+    if (Segment >= (SWCLIGHTING_GAMMA_LUT_POINTS - 1U))
+    {
+        DutyCycle = SwcRte_LightingGammaLutPB[SWCLIGHTING_GAMMA_LUT_POINTS - 1U];
+    }
+    else
+    {
+        /*the curve is increasing, High - Low does not underflow*/
+        Low = SwcRte_LightingGammaLutPB[Segment];
+        High = SwcRte_LightingGammaLutPB[Segment + 1U];
+        DutyCycle = (uint16_t)(Low + (((High - Low) * Fraction) >> SWCLIGHTING_GAMMA_SEGMENT_SHIFT));
+    }
+
+    return DutyCycle;
+#else
+    return Brightness;
+#endif
+}
+
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+/*================================================================================================*/
+/**
+@brief      SwcLighting_FadeOutputs - moves the PWM outputs of a given instance one step towards
+            the last calculated brightness
+@details    Called on every run of SwcLighting_MainRunnable. While a fade is in progress all output
+            channels of the instance are written and published as one request, channels switched
+            OFF by the feedback processing are kept OFF.
+
+@param[in]  RteAppInstance    Instance Index.
+
+@return     void
+
+@pre None
+@post None
+*/
+/*================================================================================================*/
+static void SwcLighting_FadeOutputs(SwcRte_AppInstanceIdType RteAppInstance)
+{
+    uint8_t ChIndex = 0;
+    uint16_t DutyCycle;
+    AppLightingActuatorValueType * pOutputRequest;
+
+    if (0U != SwcLighting_FadeTicksLeft[RteAppInstance])
+    {
+        SwcLighting_FadeTicksLeft[RteAppInstance]--;
+
+        if (0U == SwcLighting_FadeTicksLeft[RteAppInstance])
+        {
+            /*the last step lands on the target, whatever the rounding of SwcLighting_FadeStep*/
+            SwcLighting_FadeLevel[RteAppInstance] = (int32_t)((uint32_t)SwcLighting_OutputValue[RteAppInstance] << SWCLIGHTING_FADE_FRACTION_BITS);
+        }
+        else
+        {
+            SwcLighting_FadeLevel[RteAppInstance] += SwcLighting_FadeStep[RteAppInstance];
+        }
+
+        DutyCycle = SwcLighting_DimmingCurve((uint16_t)((uint32_t)SwcLighting_FadeLevel[RteAppInstance] >> SWCLIGHTING_FADE_FRACTION_BITS));
+
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+        pOutputRequest = SwcRte_GetLightingOutputRequestBuffer(RteAppInstance);
+#else
+        pOutputRequest = &SwcRte_aLightingActuatorData[RteAppInstance];
+#endif
+        for (ChIndex=0; ChIndex < SwcLighting_ConfigPtr[RteAppInstance].u8NoOutputChannel; ChIndex++)
+        {
+            if ((SWCRTE_CHANNEL_SHORT2GND == SwcLighting_ChannelState[RteAppInstance][ChIndex]) ||
+                (SWCRTE_CHANNEL_OPEN_LOAD == SwcLighting_ChannelState[RteAppInstance][ChIndex]))
+            {
+                pOutputRequest->aLightingOutputIntesity[ChIndex] = SWCRTE_BUTTON_OFF;
+            }
+            else
+            {
+                pOutputRequest->aLightingOutputIntesity[ChIndex] = DutyCycle;
+            }
+        }
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+        /*one request per run for all channels, written to the PWM layer together by Actuators*/
+        SwcRte_CommitLightingOutputRequest(RteAppInstance);
+#endif
+    }
+}
+#endif
+
 /*================================================================================================*/
 /**
 @brief      SwcLighting_CalculateOuputValue - calculate the next output value for all channels
@@ -203,6 +337,13 @@ static void SwcLighting_CalculateOuputValue(SwcRte_AppInstanceIdType RteAppInsta
 {
     uint8_t ChIndex = 0;
     uint32_t PotValue   = 0;
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    const AppLightingSensorValueType * pSensorData = SwcRte_GetLightingSensorData(RteAppInstance);
+    AppLightingActuatorValueType * pOutputRequest = SwcRte_GetLightingOutputRequestBuffer(RteAppInstance);
+#else
+    const AppLightingSensorValueType * pSensorData = &SwcRte_aLightingSensorData[RteAppInstance];
+    AppLightingActuatorValueType * pOutputRequest = &SwcRte_aLightingActuatorData[RteAppInstance];
+#endif
     
 	/*get sensor type*/
     switch(SwcLighting_ConfigPtr[RteAppInstance].pInstanceInputSensor[0].eInputType)
@@ -210,7 +351,7 @@ static void SwcLighting_CalculateOuputValue(SwcRte_AppInstanceIdType RteAppInsta
         case SWCRTE_DIGITAL_SENS:  /*if sensor is digital buttons*/
         {
             /*if button was pressed and than released */
-            SwcLighting_ButtonState[RteAppInstance] = (SwcRte_InputStateType)SwcRte_aLightingSensorData[RteAppInstance].aLightOutputSensorData[0].u32LightingSensorValue;
+            SwcLighting_ButtonState[RteAppInstance] = (SwcRte_InputStateType)pSensorData->aLightOutputSensorData[0].u32LightingSensorValue;
 
             if(SWCRTE_BUTTON_ON == SwcLighting_ButtonState[RteAppInstance])
             {
@@ -258,7 +399,7 @@ static void SwcLighting_CalculateOuputValue(SwcRte_AppInstanceIdType RteAppInsta
         case SWCRTE_ANALOG_POT_SENS: /*if sensor is analog potentiometer*/
         {
             /*calculate dimming based of sensor_value*/
-            PotValue = SwcRte_aLightingSensorData[RteAppInstance].aLightOutputSensorData[0].u32LightingSensorValue;
+            PotValue = pSensorData->aLightOutputSensorData[0].u32LightingSensorValue;
 
             SwcLighting_OutputValue[RteAppInstance] = ((PotValue * SWCLIGHTING_PWM_MAX_DUTY_CYCLE) >> SWCRTE_ADC_RESOLUTION);
 
@@ -290,15 +431,51 @@ static void SwcLighting_CalculateOuputValue(SwcRte_AppInstanceIdType RteAppInsta
                 SwcLighting_ChannelState[RteAppInstance][ChIndex] = SWCRTE_CHANNEL_STOPPED;
             }    
         }
-        SwcRte_aLightingActuatorData[RteAppInstance].aLightingOutputIntesity[ChIndex] = SwcLighting_OutputValue[RteAppInstance];
+        if (SWCRTE_PWM_OUT != SwcLighting_ConfigPtr[RteAppInstance].eOutputType)
+        {
+            pOutputRequest->aLightingOutputIntesity[ChIndex] = SwcLighting_OutputValue[RteAppInstance];
+        }
+#if (SWCLIGHTING_FADE == SWCRTE_STD_OFF)
+        else
+        {
+            pOutputRequest->aLightingOutputIntesity[ChIndex] = SwcLighting_DimmingCurve(SwcLighting_OutputValue[RteAppInstance]);
+        }
+#endif
     }    
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+    if (SWCRTE_PWM_OUT == SwcLighting_ConfigPtr[RteAppInstance].eOutputType)
+    {
+        /*the PWM outputs are written and published by SwcLighting_FadeOutputs, a new brightness restarts
+          the fade from the current level, an unchanged one lets the fade in progress run to its end*/
+        if (SwcLighting_OutputValue[RteAppInstance] != SwcLighting_FadeTarget[RteAppInstance])
+        {
+            SwcLighting_FadeTarget[RteAppInstance] = SwcLighting_OutputValue[RteAppInstance];
+            SwcLighting_FadeStep[RteAppInstance] = ((int32_t)((uint32_t)SwcLighting_OutputValue[RteAppInstance] << SWCLIGHTING_FADE_FRACTION_BITS) -
+                                                    SwcLighting_FadeLevel[RteAppInstance]) / (int32_t)SWCLIGHTING_FADE_TICKS;
+            SwcLighting_FadeTicksLeft[RteAppInstance] = SWCLIGHTING_FADE_TICKS;
+        }
+    }
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    else
+#endif
+#endif
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    {
+        /*all output channels written, publish the request to Actuators*/
+        SwcRte_CommitLightingOutputRequest(RteAppInstance);
+    }
+#endif
 }
 
 /*================================================================================================*/
 /**
 @brief      SwcLighting_ProcessFeedback - shall process feedback information for all channels 
             of a given instance that have analog feedback
-
+@details    Only the channels flagged in u8NoLightFeedbackChannels carry a valid measurement of the
+            published cycle, the other channels keep their state until the next valid one.
+            The load current of a PWM output follows its duty cycle: the open load limit is scaled to
+            the duty cycle of the brightness and, while a fade is in progress, only the short circuit
+            limit is checked.
 
 @param[in]  RteAppInstance    Instance Index.
 
@@ -313,15 +490,37 @@ static void SwcLighting_ProcessFeedback(SwcRte_AppInstanceIdType RteAppInstance)
 {
     uint16_t ChFbkValue = 0;
     uint8_t ChIndex =0;
+    uint16_t OpenLoadLimit = SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE;
+    boolean_t bSettled = SWCRTE_TRUE;
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    const AppLightingSensorValueType * pSensorData = SwcRte_GetLightingSensorData(RteAppInstance);
+    const AppLightingActuatorValueType * pPublishedRequest;
+    AppLightingActuatorValueType * pOutputRequest;
+    uint8_t FaultMask = 0;
+#else
+    const AppLightingSensorValueType * pSensorData = &SwcRte_aLightingSensorData[RteAppInstance];
+#endif
     
+    if (SWCRTE_PWM_OUT == SwcLighting_ConfigPtr[RteAppInstance].eOutputType)
+    {
+        /*SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE is the limit at the full duty cycle*/
+        OpenLoadLimit = (uint16_t)(((uint32_t)SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE * SwcLighting_DimmingCurve(SwcLighting_OutputValue[RteAppInstance])) /
+                                   SWCLIGHTING_PWM_MAX_DUTY_CYCLE);
+    }
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+    /*the duty cycle changes on every run of a fade, the current is only compared to it once settled*/
+    bSettled = (0U == SwcLighting_FadeTicksLeft[RteAppInstance]) ? SWCRTE_TRUE : SWCRTE_FALSE;
+#endif
+
     /*get current fdbk value (amperes) for each feedback channel*/
 
     for (ChIndex=0; ChIndex < SwcLighting_ConfigPtr[RteAppInstance].u8NoOutputChannel; ChIndex++)
     {
         /*declare/define all varialbe in application*/
-        if(SWCRTE_CHANNEL_ACTIVE == SwcLighting_ChannelState[RteAppInstance][ChIndex])
+        if((SWCRTE_CHANNEL_ACTIVE == SwcLighting_ChannelState[RteAppInstance][ChIndex]) &&
+           (0U != (pSensorData->u8NoLightFeedbackChannels & (uint8_t)(1U << ChIndex))))
         {
-            ChFbkValue = SwcRte_aLightingSensorData[RteAppInstance].aLightOutputSensorData[ChIndex].u32LightingSensorValue;
+            ChFbkValue = pSensorData->aLightOutputSensorData[ChIndex].u32LightingSensorValue;
 
 
             if(ChFbkValue > SWCLIGHTING_MAXIMUM_ANALOG_FDBK_VALUE) /*if value over maximum limit and channel is used and operational*/
@@ -330,38 +529,42 @@ static void SwcLighting_ProcessFeedback(SwcRte_AppInstanceIdType RteAppInstance)
                 SwcLighting_ChannelState[RteAppInstance][ChIndex] = SWCRTE_CHANNEL_SHORT2GND;
 
                 /*set output to OFF*/
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+                FaultMask |= (uint8_t)(1U << ChIndex);
+#else
                 SwcRte_aLightingActuatorData[RteAppInstance].aLightingOutputIntesity[ChIndex] = SWCRTE_BUTTON_OFF;
+#endif
 
                 /*TODO: Send Com info regarding issue via VDR */
             }
-            else if(ChFbkValue < SWCLIGHTING_MINIMUM_ANALOG_FDBK_VALUE) /*if value is 0 and channel is used and operational*/
+            else if((SWCRTE_TRUE == bSettled) && (ChFbkValue < OpenLoadLimit)) /*if value is 0 and channel is used and operational*/
             {
                 /*mark output channel as having: open load*/
                 SwcLighting_ChannelState[RteAppInstance][ChIndex] = SWCRTE_CHANNEL_OPEN_LOAD;
 
 
                 /*set output to OFF*/
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+                FaultMask |= (uint8_t)(1U << ChIndex);
+#else
                 SwcRte_aLightingActuatorData[RteAppInstance].aLightingOutputIntesity[ChIndex] = SWCRTE_BUTTON_OFF;
+#endif
                 
                 /*TODO: Send Com info regarding issue via VDR*/
             }
+            else if(SWCRTE_TRUE != bSettled)
+            {
+                /*fading, the first settled value starts a new comparison*/
+                SwcLighting_LastFeedbackValue[RteAppInstance][ChIndex] = 0;
+            }
             else
             {
-                /*calculate avarage feedback for each channel*/
-                SwcLighting_SumFeedbackValue[RteAppInstance][ChIndex] = SwcLighting_SumFeedbackValue[RteAppInstance][ChIndex] + ChFbkValue;
-                
-                SwcLighting_AvgValueCounter[RteAppInstance][ChIndex]++;                
-                
-                if(SwcLighting_AvgValueCounter[RteAppInstance][ChIndex] > SWCLIGHTING_AVG_SUM_COUNT)
+                /*the feedback is already averaged by the IoDal analog filter stage, a step between two
+                  consecutive values larger than the allowed error is counted as transient*/
+                if (0U != SwcLighting_LastFeedbackValue[RteAppInstance][ChIndex])
                 {
-                    SwcLighting_AvgFeedbackValue[RteAppInstance][ChIndex] = (SwcLighting_SumFeedbackValue[RteAppInstance][ChIndex] >> SWCLIGHTING_AVG_DENOMINATOR_SHIFT);
-                    SwcLighting_AvgValueCounter[RteAppInstance][ChIndex] = 0;
-
-                    /*update sum value with avarage feedback for each channel*/
-                    SwcLighting_SumFeedbackValue[RteAppInstance][ChIndex] = SwcLighting_AvgFeedbackValue[RteAppInstance][ChIndex];                    
-
-                    if (((ChFbkValue > (SwcLighting_AvgFeedbackValue[RteAppInstance][ChIndex] + SWCLIGHTING_MAX_FBK_ERR_VALUE))) || 
-                        (ChFbkValue < (SwcLighting_AvgFeedbackValue[RteAppInstance][ChIndex] - SWCLIGHTING_MAX_FBK_ERR_VALUE)))
+                    if (((ChFbkValue > (SwcLighting_LastFeedbackValue[RteAppInstance][ChIndex] + SWCLIGHTING_MAX_FBK_ERR_VALUE))) || 
+                        (ChFbkValue < (SwcLighting_LastFeedbackValue[RteAppInstance][ChIndex] - SWCLIGHTING_MAX_FBK_ERR_VALUE)))
                     {
                         SwcLighting_CountTransientError[RteAppInstance][ChIndex]++;
                     }
@@ -370,6 +573,7 @@ static void SwcLighting_ProcessFeedback(SwcRte_AppInstanceIdType RteAppInstance)
                         SwcLighting_CountTransientError[RteAppInstance][ChIndex] = 0;
                     }
                 }
+                SwcLighting_LastFeedbackValue[RteAppInstance][ChIndex] = ChFbkValue;
                 
                 if(SwcLighting_CountTransientError[RteAppInstance][ChIndex] > SWCLIGHTING_MAX_TRANSIENT_ERR_COUNT)
                 {
@@ -381,6 +585,21 @@ static void SwcLighting_ProcessFeedback(SwcRte_AppInstanceIdType RteAppInstance)
             }
         }
     }    
+
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    /*the request is published as a whole, channels without fault keep the published request*/
+    if (0U != FaultMask)
+    {
+        pPublishedRequest = SwcRte_GetLightingOutputRequest(RteAppInstance);
+        pOutputRequest = SwcRte_GetLightingOutputRequestBuffer(RteAppInstance);
+
+        for (ChIndex=0; ChIndex < SwcLighting_ConfigPtr[RteAppInstance].u8NoOutputChannel; ChIndex++)
+        {
+            pOutputRequest->aLightingOutputIntesity[ChIndex] = (0U != (FaultMask & (1U << ChIndex))) ? SWCRTE_BUTTON_OFF : pPublishedRequest->aLightingOutputIntesity[ChIndex];
+        }
+        SwcRte_CommitLightingOutputRequest(RteAppInstance);
+    }
+#endif
 }
 
 /*==================================================================================================
@@ -414,12 +633,22 @@ void SwcLighting_Init(const SwcRte_GlobalConfigType * ConfigPtr)
         SwcLighting_ButtonState[InstanceId] = SWCRTE_BUTTON_OFF;
         SwcLighting_OutputValue[InstanceId]  = SWCRTE_BUTTON_OFF;
 		SwcLighting_CountButtonPressed[InstanceId]  = 0;
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+        SwcLighting_SensorSequence[InstanceId] = 0;
+#endif
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+        SwcLighting_FadeLevel[InstanceId] = 0;
+        SwcLighting_FadeStep[InstanceId] = 0;
+        SwcLighting_FadeTicksLeft[InstanceId] = 0U;
+        SwcLighting_FadeTarget[InstanceId] = SWCRTE_BUTTON_OFF;
+#endif
 		
         for(CharsIndex = 0; CharsIndex < SWCRTE_MAX_LIGHTING_CHANNELS; CharsIndex++)
         {
             /*initialize channel state*/
             SwcLighting_ChannelState[InstanceId][CharsIndex] = SWCRTE_CHANNEL_STOPPED;
             
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_OFF)
             /*initialize actuator request data*/
             SwcRte_aLightingActuatorData[InstanceId].aLightingOutputIntesity[CharsIndex] = 0;
             
@@ -427,15 +656,15 @@ void SwcLighting_Init(const SwcRte_GlobalConfigType * ConfigPtr)
             SwcRte_aLightingSensorData[InstanceId].u8NoLightFeedbackChannels = 0;  
             SwcRte_aLightingSensorData[InstanceId].aLightOutputSensorData[CharsIndex].u32LightingSensorValue =  0;
             SwcRte_aLightingSensorData[InstanceId].aLightOutputSensorData[CharsIndex].u32LightingSensorType  =  SWCRTE_NO_SENS;
+#endif
             
-            SwcLighting_SumFeedbackValue[InstanceId][CharsIndex] = 0U;
-            SwcLighting_AvgValueCounter[InstanceId][CharsIndex] = 0U;
-            SwcLighting_AvgFeedbackValue[InstanceId][CharsIndex] = 0U;
+            SwcLighting_LastFeedbackValue[InstanceId][CharsIndex] = 0U;
             SwcLighting_CountTransientError[InstanceId][CharsIndex] = 0U;            
         }        
     }    
 }
 
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_OFF)
 /*================================================================================================*/
 /**
 @brief      SwcLighting_WriteSensorData – shall write the sensor value for the given instance
@@ -557,6 +786,8 @@ void SwcLighting_WriteOutputRequest(SwcRte_AppInstanceIdType LightingInstance, A
     }    
 }
 
+#endif
+
 /*================================================================================================*/
 /**
 @brief      SwcLighting_MainRunnable - main processing function for VDR
@@ -573,18 +804,37 @@ void SwcLighting_WriteOutputRequest(SwcRte_AppInstanceIdType LightingInstance, A
 /*================================================================================================*/
 void SwcLighting_MainRunnable(SwcRte_AppInstanceIdType RteAppInstance)
 {
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+    uint8_t Sequence;
+
+#endif
     switch(SwcLightning_InstanceState[RteAppInstance])
     {
         case  SWCRTE_READINPUTS: 
         {
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+            Sequence = SwcRte_GetLightingSensorUpdateSequence(RteAppInstance);
+
+            /*an update is processed once, a later commit carrying only new feedback does not hide it*/
+            if (Sequence != SwcLighting_SensorSequence[RteAppInstance])
+            {    
+                SwcLighting_SensorSequence[RteAppInstance] = Sequence;
+
+                /*read all inputs and calculate possible outputs*/
+                SwcLighting_CalculateOuputValue(RteAppInstance);
+#else
             if (SwcRte_aLightingSensorData[RteAppInstance].bSensorValueUpdated == SWCRTE_TRUE)
             {    
                 /*read all inputs and calculate possible outputs*/
                 SwcLighting_CalculateOuputValue(RteAppInstance);
 
                 SwcRte_aLightingSensorData[RteAppInstance].bSensorValueUpdated = SWCRTE_FALSE;
+#endif
 
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_OFF)
+                /*with SWCRTE_MULTI_RATE the feedback is processed by SwcLighting_FeedbackRunnable at its own rate*/
                 SwcLightning_InstanceState[RteAppInstance] = SWCRTE_PROCESSFEEDBACK;
+#endif
             }
         } break;
 
@@ -600,7 +850,34 @@ void SwcLighting_MainRunnable(SwcRte_AppInstanceIdType RteAppInstance)
            SwcLightning_InstanceState[RteAppInstance] = SWCRTE_READINPUTS; 
            break;
     }
+
+#if (SWCLIGHTING_FADE == SWCRTE_STD_ON)
+    /*the PWM outputs keep fading on the runs without a new sensor value*/
+    SwcLighting_FadeOutputs(RteAppInstance);
+#endif
 }
+
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+/*================================================================================================*/
+/**
+@brief      SwcLighting_FeedbackRunnable - feedback diagnostics of one Lighting instance
+@details    Called by SwcRte_MainRunnable at the feedback rate of the instance, usually a fraction of the
+            SwcLighting_MainRunnable rate. Checks the last published feedback of the active channels and
+            switches the faulty channels OFF.
+
+@param[in]  RteAppInstance    Instance Index.
+
+@return     void
+
+@pre None
+@post None
+*/
+/*================================================================================================*/
+void SwcLighting_FeedbackRunnable(SwcRte_AppInstanceIdType RteAppInstance)
+{
+    SwcLighting_ProcessFeedback(RteAppInstance);
+}
+#endif
 #endif
 
 
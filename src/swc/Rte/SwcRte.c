@@ -57,6 +57,10 @@ extern "C"{
 #include "IoDal.h"	
 #endif
 
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+#include "SwcRte_Ports.h"
+#endif
+
 #if (SWCRTE_USE_SYSDAL == SWCRTE_STD_ON)
 #include "SysDal.h"	
 #endif
@@ -178,10 +182,53 @@ extern "C"{
 #endif
 #endif
 
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON) && (SWCRTE_USE_RTE_BUFFERS == SWCRTE_STD_ON)
+    #error "SWCRTE_DOUBLE_BUFFERED_PORTS replaces SWCRTE_USE_RTE_BUFFERS"
+#endif
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON) && (IODAL_DIO_INPUT_EVENT != STD_ON)
+    #error "SWCRTE_DIGITAL_SENS_EVENT requires IODAL_DIO_INPUT_EVENT"
+#endif
+
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON) && (SWCRTE_DOUBLE_BUFFERED_PORTS != SWCRTE_STD_ON)
+    #error "SWCRTE_GENERATED_PORTS writes the output requests published by SWCRTE_DOUBLE_BUFFERED_PORTS"
+#endif
+
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON) && \
+    ((SWCRTE_GENERATED_PORTS != SWCRTE_STD_ON) || (SWCRTE_USE_SYSDAL != SWCRTE_STD_ON) || (SWCRTE_SINGLE_TASK_APPLICATION != SWCRTE_STD_ON))
+    #error "SWCRTE_PORT_BENCHMARK requires SWCRTE_GENERATED_PORTS, SWCRTE_USE_SYSDAL and SWCRTE_SINGLE_TASK_APPLICATION"
+#endif
+
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON) && \
+    ((SWCRTE_SINGLE_TASK_APPLICATION != SWCRTE_STD_ON) || (SWCRTE_DOUBLE_BUFFERED_PORTS != SWCRTE_STD_ON))
+    #error "SWCRTE_MULTI_RATE requires SWCRTE_SINGLE_TASK_APPLICATION and the rate transitions of SWCRTE_DOUBLE_BUFFERED_PORTS"
+#endif
+
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON) && \
+    ((SWCRTE_USE_SYSDAL != SWCRTE_STD_ON) || (SWCRTE_LIGTHING_APP_ENABLED != SWCRTE_STD_ON) || (SWCRTE_DOUBLE_BUFFERED_PORTS != SWCRTE_STD_ON))
+    #error "SWCRTE_SLEEP_REQUEST requires SysDal and the double buffered lighting ports"
+#endif
+
 
 /*==================================================================================================
                           LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON) && (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
+/*double buffered sender/receiver ports: aBuffer[u8Sequence & 1] is published to the readers, the other
+  buffer is filled by the writer and published by incrementing u8Sequence*/
+typedef struct
+{
+    AppLightingSensorValueType    aBuffer[2];
+    volatile uint8_t              u8Sequence;
+    volatile uint8_t              u8UpdateSequence;   /*commits with bSensorValueUpdated set*/
+} SwcRte_LightingSensorPortType;
+
+typedef struct
+{
+    AppLightingActuatorValueType  aBuffer[2];
+    volatile uint8_t              u8Sequence;
+} SwcRte_LightingActuatorPortType;
+#endif
 
 
 /*==================================================================================================
@@ -191,6 +238,21 @@ extern "C"{
 /*==================================================================================================
                                        LOCAL VARIABLES
 ==================================================================================================*/
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+/*SwcRte_MainRunnable activations left before the next run of each SwcRte_RunnableSchedulePB entry*/
+static uint8_t SwcRte_aRunnableCountdown[SWCRTE_MAX_RUNNABLES];
+
+/*SwcRte_RunnableSchedulePB entries with u8Period != 0 and u8Offset < u8Period, checked by SwcRte_Init*/
+static boolean_t SwcRte_aRunnableValid[SWCRTE_MAX_RUNNABLES];
+#endif
+
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON)
+/*consecutive SwcRte_MainRunnable runs with all lighting outputs off*/
+static uint16_t SwcRte_u16IdleRuns;
+
+/*set by SwcRte_Init when the main sensor of every lighting instance is a digital key, which wakes the ECU up*/
+static uint8_t SwcRte_bSleepAllowed;
+#endif
 
 
 /*==================================================================================================
@@ -235,14 +297,158 @@ AppInfoType                    SwcRte_aMotorCtrlInfoData[SWCRTE_MAX_MOTORCTRL_IN
 #endif /*(SWCRTE_MOTORCTRL_APP_ENABLED == SWCRTE_STD_ON)*/
 #endif /*(SWCRTE_USE_RTE_BUFFERS == SWCRTE_STD_ON)*/
 
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON) && (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
+/*Lighting Sensor port, written by Sensors and read by Lighting*/
+static SwcRte_LightingSensorPortType    SwcRte_aLightingSensorPort[SWCRTE_MAX_LIGHTING_INSTANCES];
+
+/*Lighting Actuator port, written by Lighting and read by Actuators*/
+static SwcRte_LightingActuatorPortType  SwcRte_aLightingActuatorPort[SWCRTE_MAX_LIGHTING_INSTANCES];
+#endif
+
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+/*Cost of the generic and of the generated ports, read with the debugger*/
+SwcRte_PortBenchmarkType SwcRte_PortBenchmark = {0U, 0U, 0U, 0U, 0U};
+#endif
+
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
-
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+static void SwcRte_BenchmarkPorts(void);
+#endif
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON)
+static void SwcRte_RequestEcuMode(void);
+#endif
 
 /*==================================================================================================
                                        LOCAL FUNCTIONS
 ==================================================================================================*/
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+/*===================================================================================================*/
+/**
+@brief      SwcRte_BenchmarkPorts - measures one pass over all ports through both RTE paths.
+
+@details    The generic pass reads every sensor port with SwcRte_ReadInputs and writes every output request 
+            with SwcRte_WriteOutputs, the generated pass does the same through SwcRte_Ports.h. Digital 
+            sensors read by event are skipped by both, their edge is cleared by the read. The outputs 
+            are only staged, called before SwcActuators_MainRunnable they are rewritten with the same 
+            values and driven by its SwcRte_FlushOutputs.
+
+@return     void
+
+@pre IoDal initialized and the DWT cycle counter enabled.
+@post SwcRte_PortBenchmark updated.
+*/
+/*===================================================================================================*/
+static void SwcRte_BenchmarkPorts(void)
+{
+    SwcRte_AppInputValueType aInputValue[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS];
+    const AppLightingActuatorValueType * pOutputRequest;
+    SwcRte_AppInstanceIdType AppInstance;
+    SwcRte_AppChannelIdType AppChannel;
+    uint32_t u32Start;
+    uint32_t u32GenericCycles;
+    uint32_t u32GeneratedCycles;
+
+    u32Start = SysDal_GetCycleCount();
+    for (AppInstance = 0; AppInstance < SWCRTE_MAX_APP_INSTANCES; AppInstance++)
+    {
+        for (AppChannel = 0; AppChannel < SwcRte_pGlobalCfgPtr[AppInstance].u8NoInputChannel; AppChannel++)
+        {
+    #if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+            if ((SWCRTE_DIGITAL_SENS != SwcRte_pGlobalCfgPtr[AppInstance].pInstanceInputSensor[AppChannel].eInputType) ||
+                (SWCRTE_DEBOUNCE_VERTICAL == SwcRte_pGlobalCfgPtr[AppInstance].eDigitalDebounce))
+    #endif
+            {
+                SwcRte_ReadInputs(AppInstance, AppChannel, &aInputValue[AppInstance][AppChannel]);
+            }
+        }
+
+        if (SWCRTE_LIGHTING == SwcRte_pGlobalCfgPtr[AppInstance].eInstanceType)
+        {
+            pOutputRequest = SwcRte_GetLightingOutputRequest(AppInstance);
+
+            for (AppChannel = 0; AppChannel < SwcRte_pGlobalCfgPtr[AppInstance].u8NoOutputChannel; AppChannel++)
+            {
+                SwcRte_WriteOutputs(AppInstance, AppChannel, pOutputRequest->aLightingOutputIntesity[AppChannel]);
+            }
+        }
+    }
+    u32GenericCycles = SysDal_GetCycleCount() - u32Start;
+
+    u32Start = SysDal_GetCycleCount();
+    SwcRte_Port_ReadSensors(aInputValue);
+    SwcRte_Port_WriteActuators();
+    u32GeneratedCycles = SysDal_GetCycleCount() - u32Start;
+
+    SwcRte_PortBenchmark.u32GenericCycles = u32GenericCycles;
+    if (u32GenericCycles > SwcRte_PortBenchmark.u32GenericCyclesMax)
+    {
+        SwcRte_PortBenchmark.u32GenericCyclesMax = u32GenericCycles;
+    }
+    SwcRte_PortBenchmark.u32GeneratedCycles = u32GeneratedCycles;
+    if (u32GeneratedCycles > SwcRte_PortBenchmark.u32GeneratedCyclesMax)
+    {
+        SwcRte_PortBenchmark.u32GeneratedCyclesMax = u32GeneratedCycles;
+    }
+    SwcRte_PortBenchmark.u32CycleCount++;
+}
+#endif
+
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON)
+/*===================================================================================================*/
+/**
+@brief      SwcRte_RequestEcuMode - SysDal mode request of the application.
+
+@details    The RTE keeps the ECU up while any published lighting output request is on. After 
+            SWCRTE_SLEEP_DELAY runs with all outputs off the sleep mode is requested, SysDal enters it 
+            once no other user keeps the ECU up. The ECU is woken up again by the digital key edges.
+            The analog sensors are not sampled in the sleep mode, while any instance is controlled by
+            another sensor than a digital key the ECU is kept up.
+
+@return     void
+
+@pre SysDal initialized.
+@post None
+*/
+/*===================================================================================================*/
+static void SwcRte_RequestEcuMode(void)
+{
+    const AppLightingActuatorValueType * pOutputRequest;
+    SwcRte_AppInstanceIdType LightingInstance;
+    SwcRte_AppChannelIdType ChIndex;
+    uint8_t bOutputOn = SWCRTE_FALSE;
+
+    for (LightingInstance = 0; LightingInstance < SWCRTE_MAX_LIGHTING_INSTANCES; LightingInstance++)
+    {
+        pOutputRequest = SwcRte_GetLightingOutputRequest(LightingInstance);
+
+        for (ChIndex = 0; ChIndex < SwcRte_pGlobalCfgPtr[LightingInstance].u8NoOutputChannel; ChIndex++)
+        {
+            if (0U != pOutputRequest->aLightingOutputIntesity[ChIndex])
+            {
+                bOutputOn = SWCRTE_TRUE;
+            }
+        }
+    }
+
+    if ((SWCRTE_TRUE == bOutputOn) || (SWCRTE_FALSE == SwcRte_bSleepAllowed))
+    {
+        SwcRte_u16IdleRuns = 0U;
+        SysDal_WriteModeRequest(SWCRTE_SYSDAL_USER_ID, SYSDAL_STATE_UP);
+    }
+    else if (SwcRte_u16IdleRuns < SWCRTE_SLEEP_DELAY)
+    {
+        SwcRte_u16IdleRuns++;
+    }
+    else
+    {
+        /*back from the sleep mode SysDal sets all users up, the outputs stay off for a new delay*/
+        SwcRte_u16IdleRuns = 0U;
+        SysDal_WriteModeRequest(SWCRTE_SYSDAL_USER_ID, SYSDAL_STATE_SLEEP);
+    }
+}
+#endif
 
 /*==================================================================================================
                                        GLOBAL FUNCTIONS
@@ -266,11 +472,66 @@ AppInfoType                    SwcRte_aMotorCtrlInfoData[SWCRTE_MAX_MOTORCTRL_IN
 void SwcRte_Init(const SwcRte_GlobalConfigType * ConfigPtr)
 {
     uint8_t InstanceIdx = 0;
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON) && (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
+    uint8_t BufferIdx = 0;
+    uint8_t ChIndex = 0;
+#endif
     
     if(NULL_PTR != ConfigPtr) 
     {    
         SwcRte_pGlobalCfgPtr = ConfigPtr;
         
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON) && (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
+        /*the ports are valid before the first writer runs*/
+        for (InstanceIdx = 0; InstanceIdx < SWCRTE_MAX_LIGHTING_INSTANCES; InstanceIdx++)
+        {
+            for (BufferIdx = 0; BufferIdx < 2U; BufferIdx++)
+            {
+                SwcRte_aLightingSensorPort[InstanceIdx].aBuffer[BufferIdx].bSensorValueUpdated = SWCRTE_FALSE;
+                SwcRte_aLightingSensorPort[InstanceIdx].aBuffer[BufferIdx].u8NoLightFeedbackChannels = 0;
+
+                for (ChIndex = 0; ChIndex < SWCRTE_MAX_LIGHTING_CHANNELS; ChIndex++)
+                {
+                    SwcRte_aLightingSensorPort[InstanceIdx].aBuffer[BufferIdx].aLightOutputSensorData[ChIndex].u32LightingSensorValue = 0;
+                    SwcRte_aLightingSensorPort[InstanceIdx].aBuffer[BufferIdx].aLightOutputSensorData[ChIndex].u32LightingSensorType = SWCRTE_NO_SENS;
+                    SwcRte_aLightingActuatorPort[InstanceIdx].aBuffer[BufferIdx].aLightingOutputIntesity[ChIndex] = 0;
+                }
+            }
+            SwcRte_aLightingSensorPort[InstanceIdx].u8Sequence = 0U;
+            SwcRte_aLightingSensorPort[InstanceIdx].u8UpdateSequence = 0U;
+            SwcRte_aLightingActuatorPort[InstanceIdx].u8Sequence = 0U;
+        }
+#endif
+
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+        SysDal_EnableCycleCounter();
+#endif
+
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+        for (InstanceIdx = 0; InstanceIdx < SWCRTE_MAX_RUNNABLES; InstanceIdx++)
+        {
+            /*an entry with a zero period or an offset outside the period is never run, not run at a wrong rate*/
+            SwcRte_aRunnableValid[InstanceIdx] = ((0U != SwcRte_RunnableSchedulePB[InstanceIdx].u8Period) &&
+                                                  (SwcRte_RunnableSchedulePB[InstanceIdx].u8Offset < SwcRte_RunnableSchedulePB[InstanceIdx].u8Period)) ?
+                                                 SWCRTE_TRUE : SWCRTE_FALSE;
+            SwcRte_aRunnableCountdown[InstanceIdx] = SwcRte_RunnableSchedulePB[InstanceIdx].u8Offset;
+        }
+#endif
+
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON)
+        SwcRte_u16IdleRuns = 0U;
+        SwcRte_bSleepAllowed = SWCRTE_TRUE;
+        for (InstanceIdx = 0; InstanceIdx < SWCRTE_MAX_LIGHTING_INSTANCES; InstanceIdx++)
+        {
+            /*input channel 0 is the sensor channel of the instance*/
+            if ((0U == ConfigPtr[InstanceIdx].u8NoInputChannel) ||
+                (SWCRTE_DIGITAL_SENS != ConfigPtr[InstanceIdx].pInstanceInputSensor[0].eInputType))
+            {
+                SwcRte_bSleepAllowed = SWCRTE_FALSE;
+            }
+        }
+#endif
+
         SwcSensors_Init(ConfigPtr);        
 
 #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
@@ -311,6 +572,10 @@ void SwcRte_Init(const SwcRte_GlobalConfigType * ConfigPtr)
 @brief      SwcRte_MainRunnable - main processing function for Rte
 @details    This function is called periodically by the OS or by the main() function.
             On each entry, the RTE runnable will process all other application runnables.
+            With SWCRTE_MULTI_RATE each runnable of SwcRte_RunnableSchedulePB is processed on the entries
+            selected by its period and offset, in the order of the table. The runnables exchange data only
+            through the double buffered ports, a reader at a lower rate gets the last published value.
+            With SWCRTE_SLEEP_REQUEST the SysDal mode request follows the published lighting outputs.
 
 @return     Returns the value of success
 @retval     E_OK or E_NOT_OK
@@ -321,6 +586,56 @@ void SwcRte_Init(const SwcRte_GlobalConfigType * ConfigPtr)
 /*===================================================================================================*/
 void SwcRte_MainRunnable()
 {
+#if (SWCRTE_MULTI_RATE == SWCRTE_STD_ON)
+    const SwcRte_RunnableScheduleType * pRunnable;
+    uint8_t RunnableIdx;
+
+    for (RunnableIdx = 0; RunnableIdx < SWCRTE_MAX_RUNNABLES; RunnableIdx++)
+    {
+        if (SWCRTE_TRUE != SwcRte_aRunnableValid[RunnableIdx])
+        {
+            /*invalid schedule entry, rejected by SwcRte_Init*/
+        }
+        else if (0U != SwcRte_aRunnableCountdown[RunnableIdx])
+        {
+            SwcRte_aRunnableCountdown[RunnableIdx]--;
+        }
+        else
+        {
+            pRunnable = &SwcRte_RunnableSchedulePB[RunnableIdx];
+            SwcRte_aRunnableCountdown[RunnableIdx] = pRunnable->u8Period - 1U;
+
+            switch (pRunnable->eRunnable)
+            {
+                case SWCRTE_SENSORS_RUNNABLE:
+                    SwcSensors_MainRunnable();
+                break;
+
+    #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)
+                case SWCRTE_LIGHTING_RUNNABLE:
+                    SwcLighting_MainRunnable(pRunnable->u8Instance);
+                break;
+
+                case SWCRTE_LIGHTING_FBK_RUNNABLE:
+                    SwcLighting_FeedbackRunnable(pRunnable->u8Instance);
+                break;
+    #endif
+
+                case SWCRTE_ACTUATORS_RUNNABLE:
+                {
+    #if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+                    SwcRte_BenchmarkPorts();
+    #endif
+                    SwcActuators_MainRunnable();
+                }break;
+
+                default:
+                    /*DO NOTHING*/
+                break;
+            }
+        }
+    }
+#else
     uint8_t InstanceIdx = 0;
 
     SwcSensors_MainRunnable();
@@ -332,7 +647,16 @@ void SwcRte_MainRunnable()
     }
 #endif
 
+#if (SWCRTE_PORT_BENCHMARK == SWCRTE_STD_ON)
+    SwcRte_BenchmarkPorts();
+#endif
+
     SwcActuators_MainRunnable();
+#endif /*SWCRTE_MULTI_RATE*/
+
+#if (SWCRTE_SLEEP_REQUEST == SWCRTE_STD_ON)
+    SwcRte_RequestEcuMode();
+#endif
 }
 #endif/*SWCRTE_SINGLE_TASK_APPLICATION*/
 
@@ -467,6 +791,178 @@ void SwcRte_WriteLightingComInfo (SwcRte_AppInstanceIdType LightingInstance,  Ap
 }
 #endif /*SWCRTE_VDR_APP_ENABLED*/
 
+#if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingSensorBuffer - shall return the buffer the Sensors application fills with the
+            sensor values of the given instance of the Lighting application.
+
+@details    The buffer is not visible to the readers until SwcRte_CommitLightingSensorData, its content is the
+            one published two commits earlier and every field read by Lighting shall be written again.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Buffer to be written in place.
+
+@pre        Single writer per instance
+@post None
+*/
+/*==========================================================================================================*/
+AppLightingSensorValueType * SwcRte_GetLightingSensorBuffer(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return &SwcRte_aLightingSensorPort[LightingInstance].aBuffer[(SwcRte_aLightingSensorPort[LightingInstance].u8Sequence + 1U) & 1U];
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_CommitLightingSensorData - shall publish the buffer filled by the Sensors application.
+
+@details    Publishing is a single byte write, a reader gets either the previous or the new buffer, never a mix.
+            A buffer with bSensorValueUpdated also advances the update count, after it is published.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     void
+
+@pre        SwcRte_GetLightingSensorBuffer buffer fully written
+@post None
+*/
+/*==========================================================================================================*/
+void SwcRte_CommitLightingSensorData(SwcRte_AppInstanceIdType LightingInstance)
+{
+    boolean_t bUpdated = SwcRte_GetLightingSensorBuffer(LightingInstance)->bSensorValueUpdated;
+
+    SwcRte_aLightingSensorPort[LightingInstance].u8Sequence++;
+
+    if (SWCRTE_TRUE == bUpdated)
+    {
+        SwcRte_aLightingSensorPort[LightingInstance].u8UpdateSequence++;
+    }
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingSensorData - shall return the sensor values published for the given instance
+            of the Lighting application, without copying them.
+
+@details    The returned buffer stays unchanged until the writer has committed twice, which does not happen
+            while the Lighting runnable is executing as long as Sensors is not preempting it more than once.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Published sensor values, read only.
+
+@pre None
+@post None
+*/
+/*==========================================================================================================*/
+const AppLightingSensorValueType * SwcRte_GetLightingSensorData(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return &SwcRte_aLightingSensorPort[LightingInstance].aBuffer[SwcRte_aLightingSensorPort[LightingInstance].u8Sequence & 1U];
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingSensorSequence - shall return the commit count of the sensor port of the given
+            instance of the Lighting application.
+
+@details    The count changes with every commit, a reader compares it to detect new data or, read before and
+            after the data, a buffer overwritten while being read.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Commit count, wraps around.
+
+@pre None
+@post None
+*/
+/*==========================================================================================================*/
+uint8_t SwcRte_GetLightingSensorSequence(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return SwcRte_aLightingSensorPort[LightingInstance].u8Sequence;
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingSensorUpdateSequence - shall return the count of committed sensor value updates 
+            of the given instance of the Lighting application.
+
+@details    The port is also committed for new feedback only. The count changes with the commits carrying
+            bSensorValueUpdated, a reader running at a lower rate than the writer detects an update even when
+            a commit without update was published after it. The published buffer holds the newest values.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Update count, wraps around.
+
+@pre None
+@post None
+*/
+/*==========================================================================================================*/
+uint8_t SwcRte_GetLightingSensorUpdateSequence(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return SwcRte_aLightingSensorPort[LightingInstance].u8UpdateSequence;
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingOutputRequestBuffer - shall return the buffer the Lighting application fills
+            with the output request of the given instance.
+
+@details    The buffer is not visible to Actuators until SwcRte_CommitLightingOutputRequest, its content is the
+            one published two commits earlier and all output channels shall be written again.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Buffer to be written in place.
+
+@pre        Single writer per instance
+@post None
+*/
+/*==========================================================================================================*/
+AppLightingActuatorValueType * SwcRte_GetLightingOutputRequestBuffer(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return &SwcRte_aLightingActuatorPort[LightingInstance].aBuffer[(SwcRte_aLightingActuatorPort[LightingInstance].u8Sequence + 1U) & 1U];
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_CommitLightingOutputRequest - shall publish the output request filled by the Lighting
+            application.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     void
+
+@pre        SwcRte_GetLightingOutputRequestBuffer buffer fully written
+@post None
+*/
+/*==========================================================================================================*/
+void SwcRte_CommitLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance)
+{
+    SwcRte_aLightingActuatorPort[LightingInstance].u8Sequence++;
+}
+
+/*==========================================================================================================*/
+/**
+@brief      SwcRte_GetLightingOutputRequest - shall return the output request published by the given instance
+            of the Lighting application, without copying it.
+
+@details    See SwcRte_GetLightingSensorData.
+
+@param[in]  LightingInstance    Instance Index.
+
+@return     Published output request, read only.
+
+@pre None
+@post None
+*/
+/*==========================================================================================================*/
+const AppLightingActuatorValueType * SwcRte_GetLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance)
+{
+    return &SwcRte_aLightingActuatorPort[LightingInstance].aBuffer[SwcRte_aLightingActuatorPort[LightingInstance].u8Sequence & 1U];
+}
+#else
 /*==========================================================================================================*/
 /**
 @brief      SwcRte_WriteLightingSensorData – shall write the sensor value for the given instance 
@@ -601,6 +1097,7 @@ void SwcRte_WriteLightingOutputRequest(SwcRte_AppInstanceIdType LightingInstance
 
    SwcLighting_WriteOutputRequest(LightingInstance, Value);
 }
+#endif/*SWCRTE_DOUBLE_BUFFERED_PORTS*/
 #endif/*SWCRTE_LIGTHING_APP_ENABLED*/
 
 
@@ -888,6 +1385,24 @@ void SwcRte_WriteComData (SwcRte_AppInstanceIdType AppInstance, AppComChannelTyp
 #endif
 
 
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_SampleInputs - shall latch the sensor inputs read by the IoDal component during the current cycle.
+
+@details    Called once at the start of the sensor processing, all SwcRte_ReadInputs of the cycle then see the
+            same snapshot of the digital inputs.
+
+@return     void
+
+@pre None
+@post None
+*/
+/*==============================================================================================================*/
+void SwcRte_SampleInputs(void) 
+{        
+    IoDal_SampleInputs();
+}
+
 /*==============================================================================================================*/
 /**
 @brief      SwcRte_ReadLightingComInfo - shall read the value associated to a Sensor channel which determined by the IoDal component. 
@@ -923,6 +1438,43 @@ void SwcRte_ReadInputs(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannelId
     }
 }
 
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_ReadInputEvent - shall read the edge latched on a Sensor channel by the IoDal component.
+
+@details    Only digital sensor channels mapped on IoDal event inputs can be read, the edge is cleared by the read.
+
+@return     void
+
+@pre None
+@post None
+*/
+/*==============================================================================================================*/
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+void SwcRte_ReadInputEvent(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannelIdType SensorChannel, SwcRte_AppInputEventType * InputEvent) 
+{        
+    SwcRte_AppChannelIdType InputSensor;
+    IoDal_InputEventType IoDalInputEvent;
+    
+    InputSensor = (SwcRte_pGlobalCfgPtr[AppInstance].pInstanceInputSensor[SensorChannel]).u8InputChannel;
+    
+    if (E_OK == IoDal_ReadInputEvent(InputSensor, &IoDalInputEvent))
+    {    
+        InputEvent->Status = SWCRTE_MEAS_OK;    
+        InputEvent->bEdgeDetected = (TRUE == IoDalInputEvent.EdgeDetected) ? SWCRTE_TRUE : SWCRTE_FALSE;
+        InputEvent->u32EdgeAge = IoDalInputEvent.EdgeAge;
+        InputEvent->Value = (uint16)IoDalInputEvent.Level;
+    }
+    else
+    {
+        InputEvent->Status = SWCRTE_MEAS_NOT_OK;        
+        InputEvent->bEdgeDetected = SWCRTE_FALSE;
+        InputEvent->u32EdgeAge = 0U;
+        InputEvent->Value = 0U;
+    }
+}
+#endif
+
 /*==============================================================================================================*/
 /**
 @brief      SwcRte_ReadLightingComInfo - shall write the value associated to a Actuator channel which is determined by the IoDal component. 
@@ -946,6 +1498,86 @@ void SwcRte_WriteOutputs(SwcRte_AppInstanceIdType AppInstance, SwcRte_AppChannel
     IoDal_WriteOutputs(OutputChannel, OutputValue);
 }
 
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_FlushOutputs - shall apply the actuator outputs written by the SWCs during the current cycle.
+
+@details    Called once at the end of the actuator processing, the digital outputs written by all 
+            SwcRte_WriteOutputs of the cycle are then driven with one masked write per port.
+
+@return     void
+
+@pre None
+@post None
+*/
+/*==============================================================================================================*/
+void SwcRte_FlushOutputs(void) 
+{        
+    IoDal_FlushOutputs();
+}
+
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_ReadSensorPorts - shall read all sensor ports through the accessors generated in SwcRte_Ports.h.
+
+@details    Same values as SwcRte_ReadInputs for every instance and sensor channel, without the configuration 
+            lookup and the IoDal channel type dispatch. Digital sensors read by event are left unchanged,
+            the ones debounced with SWCRTE_DEBOUNCE_VERTICAL are always read.
+
+@param[out] InputValue      Sensor values indexed by instance and sensor channel.
+
+@return     void
+
+@pre IoDal initialized.
+@post None
+*/
+/*==============================================================================================================*/
+void SwcRte_ReadSensorPorts(SwcRte_AppInputValueType InputValue[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS]) 
+{
+    SwcRte_Port_ReadSensors(InputValue);
+}
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_ReadSensorEventPorts - shall read the edges of all digital sensor ports through SwcRte_Ports.h.
+
+@details    Same events as SwcRte_ReadInputEvent, the edges are cleared by the read. Other sensors are left unchanged.
+
+@param[out] InputEvent      Sensor events indexed by instance and sensor channel.
+
+@return     void
+
+@pre IoDal initialized.
+@post None
+*/
+/*==============================================================================================================*/
+void SwcRte_ReadSensorEventPorts(SwcRte_AppInputEventType InputEvent[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS]) 
+{
+    SwcRte_Port_ReadSensorEvents(InputEvent);
+}
+#endif
+
+/*==============================================================================================================*/
+/**
+@brief      SwcRte_WriteActuatorPorts - shall write the published output requests to all actuator ports.
+
+@details    Same outputs as SwcRte_WriteOutputs for every lighting instance and output channel, through the 
+            accessors generated in SwcRte_Ports.h. The outputs are driven by SwcRte_FlushOutputs.
+
+@return     void
+
+@pre IoDal initialized.
+@post None
+*/
+/*==============================================================================================================*/
+void SwcRte_WriteActuatorPorts(void) 
+{
+    SwcRte_Port_WriteActuators();
+}
+#endif
+
 /*================================================================================================*/
 /*================================================================================================*/
 #ifdef __cplusplus
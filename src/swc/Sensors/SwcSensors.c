@@ -112,6 +112,25 @@ extern "C"{
 ==================================================================================================*/
 #define  SWCSENSORS_MAX_DEBOUNCE  3U
 
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+#if (SWCRTE_USE_SYSDAL != SWCRTE_STD_ON)
+    #error "SWCRTE_DIGITAL_SENS_EVENT requires SWCRTE_USE_SYSDAL"
+#endif
+
+/*contact bounce time of an event input, the edge age is counted in core cycles*/
+#define  SWCSENSORS_EVENT_DEBOUNCE_US      5000UL
+#define  SWCSENSORS_EVENT_DEBOUNCE_CYCLES  SwcRte_UsToCycles(SWCSENSORS_EVENT_DEBOUNCE_US)
+#endif
+
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+#if ((SWCRTE_MAX_APP_INSTANCES * SWCRTE_MAX_INPUT_CHANNELS) > 32U)
+    #error "SWCRTE_DEBOUNCE_VERTICAL debounces up to 32 sensor channels"
+#endif
+
+/*bit of a sensor channel in the vertical counter words*/
+#define  SWCSENSORS_VERTICAL_BIT(Instance, Channel)  ((uint32_t)1U << (((uint32_t)(Instance) * SWCRTE_MAX_INPUT_CHANNELS) + (uint32_t)(Channel)))
+#endif
+
 /*==================================================================================================
                                       FILE VERSION CHECKS
 ===================================================================================================*/
@@ -146,6 +165,27 @@ uint8_t SwcSensors_DioSensorHighValueCounter[SWCRTE_MAX_APP_INSTANCES];
  (buttons) as main control devices*/
 /* array size is given by the number of instances using a digital inputsas main sensor*/
 uint8_t SwcSensors_DioSensorLowValueCounter[SWCRTE_MAX_APP_INSTANCES];
+
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+/*array of variable set from an edge of the digital input until the input is stable for the bounce time*/
+uint8_t SwcSensors_DioEventDebouncing[SWCRTE_MAX_APP_INSTANCES];
+
+/*array of variable holding the debounced level of the digital inputs*/
+uint16_t SwcSensors_DioEventLevel[SWCRTE_MAX_APP_INSTANCES];
+#endif
+#endif
+
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+/*vertical counters of the digital inputs debounced with SWCRTE_DEBOUNCE_VERTICAL, one bit per input in each word*/
+/*debounced level of the inputs*/
+uint32_t SwcSensors_VerticalState;
+
+/*bit 0 and bit 1 of the number of consecutive samples that differ from the debounced level*/
+uint32_t SwcSensors_VerticalCount0;
+uint32_t SwcSensors_VerticalCount1;
+
+/*inputs whose debounced level changed in the current cycle*/
+uint32_t SwcSensors_VerticalToggle;
 #endif
 /*==================================================================================================
                                        GLOBAL CONSTANTS
@@ -162,9 +202,43 @@ uint8_t SwcSensors_DioSensorLowValueCounter[SWCRTE_MAX_APP_INSTANCES];
 ===================================================================================================*/
 static const SwcRte_GlobalConfigType * SwcSensors_ConfigPtr;
 
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+static void SwcSensors_VerticalDebounce(uint32_t Sample);
+#endif
+
 /*===================================================================================================
                                        LOCAL FUNCTIONS
 ====================================================================================================*/
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+/*===================================================================================================*/
+/**
+@brief      SwcSensors_VerticalDebounce - debounces all SWCRTE_DEBOUNCE_VERTICAL inputs at once
+@details    Each input owns one bit of the vertical counter words, the 2 bit counter of an input counts the
+            consecutive samples that differ from its debounced level and restarts when a sample matches it.
+            The new level is accepted when the counter wraps on the 4th differing sample, as the 
+            SWCSENSORS_MAX_DEBOUNCE counters. The cost does not depend on the number of inputs.
+
+@param[in]  Sample    Levels of the current cycle, bit SWCSENSORS_VERTICAL_BIT set for SWCRTE_BUTTON_ON.
+
+@return     void
+
+@pre None
+@post SwcSensors_VerticalToggle holds the inputs whose debounced level changed.
+*/
+/*===================================================================================================*/
+static void SwcSensors_VerticalDebounce(uint32_t Sample)
+{
+    uint32_t Delta;
+
+    Delta = Sample ^ SwcSensors_VerticalState;
+
+    SwcSensors_VerticalCount1 = (SwcSensors_VerticalCount1 ^ SwcSensors_VerticalCount0) & Delta;
+    SwcSensors_VerticalCount0 = ~SwcSensors_VerticalCount0 & Delta;
+
+    SwcSensors_VerticalToggle = Delta & ~(SwcSensors_VerticalCount0 | SwcSensors_VerticalCount1);
+    SwcSensors_VerticalState ^= SwcSensors_VerticalToggle;
+}
+#endif
 
 
 /*===================================================================================================
@@ -192,6 +266,14 @@ void SwcSensors_Init(const SwcRte_GlobalConfigType * ConfigPtr)
         
     SwcSensors_ConfigPtr = ConfigPtr;
 
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+    /*all inputs start OFF, a level ON at start up is reported once stable*/
+    SwcSensors_VerticalState = 0U;
+    SwcSensors_VerticalCount0 = 0U;
+    SwcSensors_VerticalCount1 = 0U;
+    SwcSensors_VerticalToggle = 0U;
+#endif
+
     for (RteAppInstance=0; RteAppInstance < SWCRTE_MAX_APP_INSTANCES; RteAppInstance++)
     {
         SensorType = SwcSensors_ConfigPtr[RteAppInstance].pInstanceInputSensor[0].eInputType;
@@ -201,6 +283,11 @@ void SwcSensors_Init(const SwcRte_GlobalConfigType * ConfigPtr)
         {                
             SwcSensors_DioSensorHighValueCounter[RteAppInstance] = 0U;
             SwcSensors_DioSensorLowValueCounter[RteAppInstance] = 0U;
+        #if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+            /*the level at start up is accepted once stable, as after an edge*/
+            SwcSensors_DioEventDebouncing[RteAppInstance] = SWCRTE_TRUE;
+            SwcSensors_DioEventLevel[RteAppInstance] = (uint16_t)SWCRTE_BUTTON_OFF;
+        #endif
         }
     #endif
     #if SWCRTE_MAX_ANSENS_INSTANCES > 0
@@ -231,8 +318,18 @@ void SwcSensors_MainRunnable()
     SwcRte_AppInstanceIdType RteAppInstance;
     SwcRte_AppInputSensorType SensorType;
     SwcRte_AppInputValueType InputValue;
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+    SwcRte_AppInputEventType InputEvent;
+#endif
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+    SwcRte_AppInputValueType aInputValue[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS];
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+    SwcRte_AppInputEventType aInputEvent[SWCRTE_MAX_APP_INSTANCES][SWCRTE_MAX_INPUT_CHANNELS];
+#endif
+#endif
 #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)        
     AppLightingSensorValueType  AppLightingWriteValue;
+    AppLightingSensorValueType * pAppLightingWriteValue = &AppLightingWriteValue;
 #endif
 #if (SWCRTE_MOTORCTRL_APP_ENABLED == SWCRTE_STD_ON)    
    AppMotorCtrlSensorValueType  AppMotorCtrlWriteValue;
@@ -240,15 +337,76 @@ void SwcSensors_MainRunnable()
 
 #if SWCRTE_MAX_DISENS_INSTANCES > 0    
     uint16_t SensorValue = 0;
+#endif
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+    uint32_t VerticalSample = 0U;
+    uint32_t VerticalBit;
 #endif
     InputValue.Value =0;
     InputValue.Status = SWCRTE_MEAS_NOT_OK;
     
+    /*one coherent snapshot of the inputs for all instances of this cycle*/
+    SwcRte_SampleInputs();
+    
+#if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+    /*all sensor ports read at once, the instances below only index the results*/
+    SwcRte_ReadSensorPorts(aInputValue);
+#if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+    SwcRte_ReadSensorEventPorts(aInputEvent);
+#endif
+#endif
+
+#if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+    /*pack the levels of the vertically debounced inputs into one word and debounce them together*/
+    for (RteAppInstance = 0; RteAppInstance < SWCRTE_MAX_APP_INSTANCES; RteAppInstance++)
+    {
+        if (SWCRTE_DEBOUNCE_VERTICAL == SwcSensors_ConfigPtr[RteAppInstance].eDigitalDebounce)
+        {
+            for (SensorChannelId = 0; SensorChannelId < SwcSensors_ConfigPtr[RteAppInstance].u8NoInputChannel; SensorChannelId++)
+            {
+                if (SWCRTE_DIGITAL_SENS == SwcSensors_ConfigPtr[RteAppInstance].pInstanceInputSensor[SensorChannelId].eInputType)
+                {
+                #if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+                    InputValue = aInputValue[RteAppInstance][SensorChannelId];
+                #else
+                    SwcRte_ReadInputs(RteAppInstance, SensorChannelId,  &InputValue);
+                #endif
+                    VerticalBit = SWCSENSORS_VERTICAL_BIT(RteAppInstance, SensorChannelId);
+
+                    if (SWCRTE_MEAS_OK == InputValue.Status)
+                    {
+                        VerticalSample |= (SWCRTE_BUTTON_ON == (SwcRte_InputStateType)InputValue.Value) ? VerticalBit : 0U;
+                    }
+                    else
+                    {
+                        /*an input that cannot be read keeps its debounced level*/
+                        VerticalSample |= SwcSensors_VerticalState & VerticalBit;
+                    }
+                }
+            }
+        }
+    }
+    SwcSensors_VerticalDebounce(VerticalSample);
+#endif
+
     for (RteAppInstance = 0; RteAppInstance < SWCRTE_MAX_APP_INSTANCES; RteAppInstance++)
     {
+    #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON) && (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+        /*lighting instances fill the back buffer of their sensor port in place, starting from the published
+          values: a channel not written in this cycle keeps its value when the port is committed for feedback*/
+        if (SWCRTE_LIGHTING == SwcSensors_ConfigPtr[RteAppInstance].eInstanceType)
+        {
+            pAppLightingWriteValue = SwcRte_GetLightingSensorBuffer(RteAppInstance);
+            *pAppLightingWriteValue = *SwcRte_GetLightingSensorData(RteAppInstance);
+        }
+        else
+        {
+            pAppLightingWriteValue = &AppLightingWriteValue;
+        }
+    #endif
     #if SWCRTE_MAX_DISENS_INSTANCES > 0        
-        AppLightingWriteValue.bSensorValueUpdated = SWCRTE_FALSE;
-		AppLightingWriteValue.u8NoLightFeedbackChannels  = 0;
+        pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_FALSE;
+		pAppLightingWriteValue->u8NoLightFeedbackChannels  = 0;
     #endif
         /*for all available inputs */        
         for (SensorChannelId = 0; SensorChannelId < SwcSensors_ConfigPtr[RteAppInstance].u8NoInputChannel; SensorChannelId++)
@@ -256,10 +414,24 @@ void SwcSensors_MainRunnable()
             /*get the sensor channel id base on type of channel  */            
             SensorType = SwcSensors_ConfigPtr[RteAppInstance].pInstanceInputSensor[SensorChannelId].eInputType;       
             
-            SwcRte_ReadInputs(RteAppInstance, SensorChannelId,  &InputValue);
+        #if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+            /*digital sensors are only read when an edge was latched*/
+            if (SWCRTE_DIGITAL_SENS != SensorType)
+        #elif (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+            /*vertically debounced sensors were read before the debounce*/
+            if ((SWCRTE_DIGITAL_SENS != SensorType) || (SWCRTE_DEBOUNCE_VERTICAL != SwcSensors_ConfigPtr[RteAppInstance].eDigitalDebounce))
+        #endif
+            {
+            #if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+                InputValue = aInputValue[RteAppInstance][SensorChannelId];
+            #else
+                SwcRte_ReadInputs(RteAppInstance, SensorChannelId,  &InputValue);
+            #endif
+            }
  
-        #if SWCRTE_MAX_DISENS_INSTANCES > 0   
-            AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = 0;
+        #if (SWCRTE_MAX_DISENS_INSTANCES > 0) && \
+            !((SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON) && (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON))
+            pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = 0;
         #endif    
                        
             /*process values differently depending on their type*/
@@ -268,45 +440,91 @@ void SwcSensors_MainRunnable()
             #if SWCRTE_MAX_DISENS_INSTANCES > 0
                 case SWCRTE_DIGITAL_SENS:
                 {                                
-                    if (SWCRTE_BUTTON_ON == (SwcRte_InputStateType)InputValue.Value) 
-                    {    
-                        /*increment ON counter*/
-                        SwcSensors_DioSensorHighValueCounter[RteAppInstance]++;
+                #if (SWCRTE_VERTICAL_DEBOUNCE == SWCRTE_STD_ON)
+                    if (SWCRTE_DEBOUNCE_VERTICAL == SwcSensors_ConfigPtr[RteAppInstance].eDigitalDebounce)
+                    {
+                        /*debounced with all vertical inputs at the start of the cycle, report changes only*/
+                        VerticalBit = SWCSENSORS_VERTICAL_BIT(RteAppInstance, SensorChannelId);
+                        SensorValue = (0U != (SwcSensors_VerticalState & VerticalBit)) ? (uint16_t)SWCRTE_BUTTON_ON : (uint16_t)SWCRTE_BUTTON_OFF;
+
+                        if (0U != (SwcSensors_VerticalToggle & VerticalBit))
+                        {
+                            pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_TRUE;
+                        }
+                    }
+                    else
+                #endif
+                    {
+                    #if (SWCRTE_DIGITAL_SENS_EVENT == SWCRTE_STD_ON)
+                        /*idle inputs cost one edge check, the level is read and debounced only after an edge*/
+                    #if (SWCRTE_GENERATED_PORTS == SWCRTE_STD_ON)
+                        InputEvent = aInputEvent[RteAppInstance][SensorChannelId];
+                    #else
+                        SwcRte_ReadInputEvent(RteAppInstance, SensorChannelId, &InputEvent);
+                    #endif
+
+                        if (SWCRTE_TRUE == InputEvent.bEdgeDetected)
+                        {
+                            SwcSensors_DioEventDebouncing[RteAppInstance] = SWCRTE_TRUE;
+                        }
+
+                        /*accept the level once no edge occurred for the bounce time, report changes only*/
+                        if ((SWCRTE_MEAS_OK == InputEvent.Status) &&
+                            (SWCRTE_TRUE == SwcSensors_DioEventDebouncing[RteAppInstance]) &&
+                            (InputEvent.u32EdgeAge >= SWCSENSORS_EVENT_DEBOUNCE_CYCLES))
+                        {
+                            SwcSensors_DioEventDebouncing[RteAppInstance] = SWCRTE_FALSE;
+
+                            if (InputEvent.Value != SwcSensors_DioEventLevel[RteAppInstance])
+                            {
+                                SwcSensors_DioEventLevel[RteAppInstance] = InputEvent.Value;
+                                pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_TRUE;
+                            }
+                        }
+
+                        SensorValue = SwcSensors_DioEventLevel[RteAppInstance];
+                    #else
+                        if (SWCRTE_BUTTON_ON == (SwcRte_InputStateType)InputValue.Value) 
+                        {    
+                            /*increment ON counter*/
+                            SwcSensors_DioSensorHighValueCounter[RteAppInstance]++;
                         
-                        /*decrement OFF counter*/
-                        SwcSensors_DioSensorLowValueCounter[RteAppInstance] = 0U;
+                            /*decrement OFF counter*/
+                            SwcSensors_DioSensorLowValueCounter[RteAppInstance] = 0U;
                       
-                        /*is ON counter max value?*/
-                        if (SwcSensors_DioSensorHighValueCounter[RteAppInstance] > SWCSENSORS_MAX_DEBOUNCE)
+                            /*is ON counter max value?*/
+                            if (SwcSensors_DioSensorHighValueCounter[RteAppInstance] > SWCSENSORS_MAX_DEBOUNCE)
+                            {    
+                                SensorValue = (uint16_t)SWCRTE_BUTTON_ON;
+                                SwcSensors_DioSensorHighValueCounter[RteAppInstance] = 0U;
+                                pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_TRUE;                              
+                            }                        
+                        }
+                        else
                         {    
-                            SensorValue = (uint16_t)SWCRTE_BUTTON_ON;
-                            SwcSensors_DioSensorHighValueCounter[RteAppInstance] = 0U;
-                            AppLightingWriteValue.bSensorValueUpdated = SWCRTE_TRUE;                              
-                        }                        
-                    }
-                    else
-                    {    
-                        /*increment ON counter*/
-                        SwcSensors_DioSensorHighValueCounter[RteAppInstance]= 0U;
+                            /*increment ON counter*/
+                            SwcSensors_DioSensorHighValueCounter[RteAppInstance]= 0U;
                         
-                        /*decrement OFF counter*/
-                        SwcSensors_DioSensorLowValueCounter[RteAppInstance]++;
+                            /*decrement OFF counter*/
+                            SwcSensors_DioSensorLowValueCounter[RteAppInstance]++;
                                                 
-                        /*is ON counter max value?*/
-                        if (SwcSensors_DioSensorLowValueCounter[RteAppInstance] > SWCSENSORS_MAX_DEBOUNCE)
-                        {    
-                            SensorValue = (uint16_t)SWCRTE_BUTTON_OFF;
-                            SwcSensors_DioSensorLowValueCounter[RteAppInstance] = 0U;
-                            AppLightingWriteValue.bSensorValueUpdated = SWCRTE_TRUE;  
-                        }    
+                            /*is ON counter max value?*/
+                            if (SwcSensors_DioSensorLowValueCounter[RteAppInstance] > SWCSENSORS_MAX_DEBOUNCE)
+                            {    
+                                SensorValue = (uint16_t)SWCRTE_BUTTON_OFF;
+                                SwcSensors_DioSensorLowValueCounter[RteAppInstance] = 0U;
+                                pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_TRUE;  
+                            }    
+                        }
+                    #endif
                     }
                     
                     #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)                        
                     if(SWCRTE_LIGHTING == SwcSensors_ConfigPtr[RteAppInstance].eInstanceType)
                     {                        
-                        AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
+                        pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
                         
-                        AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = SensorValue;                 
+                        pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = SensorValue;                 
                     }
                     #endif    
                     
@@ -328,11 +546,11 @@ void SwcSensors_MainRunnable()
                         #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)                            
                         if(SWCRTE_LIGHTING == SwcSensors_ConfigPtr[RteAppInstance].eInstanceType)
                         {    
-                            AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
+                            pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
                             
-                            AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = InputValue.Value;
+                            pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = InputValue.Value;
                             
-                            AppLightingWriteValue.bSensorValueUpdated = SWCRTE_TRUE;
+                            pAppLightingWriteValue->bSensorValueUpdated = SWCRTE_TRUE;
                         }
                         #endif                    
                         #if (SWCRTE_MOTORCTRL_APP_ENABLED == SWCRTE_STD_ON)        
@@ -370,13 +588,14 @@ void SwcSensors_MainRunnable()
                     #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)    
                     if(SWCRTE_LIGHTING == SwcSensors_ConfigPtr[RteAppInstance].eInstanceType)
                     {
-                        AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = InputValue.Value;
-                        
-                        AppLightingWriteValue.aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
+                        pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorType = SensorType;
                         
+                        /*a channel that cannot be read is left out of the mask, Lighting skips its value*/
                         if(InputValue.Status == SWCRTE_MEAS_OK)
                         {
-                            AppLightingWriteValue.u8NoLightFeedbackChannels |= (1 << SensorChannelId);    
+                            pAppLightingWriteValue->aLightOutputSensorData[SensorChannelId].u32LightingSensorValue = InputValue.Value;
+                            
+                            pAppLightingWriteValue->u8NoLightFeedbackChannels |= (1 << SensorChannelId);    
                         }
                     }
                     #endif
@@ -422,7 +641,17 @@ void SwcSensors_MainRunnable()
     #if (SWCRTE_LIGTHING_APP_ENABLED == SWCRTE_STD_ON)    
         if(SWCRTE_LIGHTING == SwcSensors_ConfigPtr[RteAppInstance].eInstanceType)
         {                
-             SwcRte_WriteLightingSensorData(RteAppInstance, &AppLightingWriteValue);            
+        #if (SWCRTE_DOUBLE_BUFFERED_PORTS == SWCRTE_STD_ON)
+            /*published with a value update or a new feedback measurement, the update is counted by the port
+              so a Lighting instance running at a lower rate does not miss it*/
+            if ((SWCRTE_TRUE == pAppLightingWriteValue->bSensorValueUpdated) ||
+                (0U != pAppLightingWriteValue->u8NoLightFeedbackChannels))
+            {
+                SwcRte_CommitLightingSensorData(RteAppInstance);
+            }
+        #else
+             SwcRte_WriteLightingSensorData(RteAppInstance, pAppLightingWriteValue);            
+        #endif
         }
     #endif    
     #if (SWCRTE_MOTORCTRL_APP_ENABLED == SWCRTE_STD_ON)    